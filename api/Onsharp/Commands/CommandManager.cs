@@ -47,11 +47,7 @@ namespace Onsharp.Commands
                     }
                     
                     Bridge.OccupyCommand(command.Name);
-                    Onset.RegisterCommand(_server?.Owner.Plugin.Meta.Id ?? "native", command.Name);
-                    foreach (string alias in command.Aliases)
-                    {
-                        Onset.RegisterCommandAlias(_server?.Owner.Plugin.Meta.Id ?? "native", command.Name, alias);
-                    }
+                    RegisterNative(command);
                     
                     command.SetHandler(owner, method);
                     _commands.Add(command);
@@ -84,11 +80,7 @@ namespace Onsharp.Commands
                     }
                     
                     Bridge.OccupyCommand(command.Name);
-                    Onset.RegisterCommand(_server?.Owner.Plugin.Meta.Id ?? "native", command.Name);
-                    foreach (string alias in command.Aliases)
-                    {
-                        Onset.RegisterCommandAlias(_server?.Owner.Plugin.Meta.Id ?? "native", command.Name, alias);
-                    }
+                    RegisterNative(command);
                     
                     command.SetHandler(null, method);
                     _commands.Add(command);
@@ -99,15 +91,29 @@ namespace Onsharp.Commands
         }
 
         /// <summary>
-        /// Tries to execute a command with the belonging data derived from the given line of text.<br/>
+        /// Registers the given command and all of its aliases on the native side.
+        /// </summary>
+        /// <param name="command">The command to be registered</param>
+        private void RegisterNative(Command command)
+        {
+            int handle = Onset.RegisterCommand(command.Name);
+            Bridge.RegisterCommandHandle(handle, _server?.Owner.Plugin.Meta.Id ?? "native", command.Name);
+            foreach (string alias in command.Aliases)
+            {
+                Onset.RegisterCommandAlias(handle, alias);
+            }
+        }
+
+        /// <summary>
+        /// Tries to execute a command with the belonging data derived from the given tokens.<br/>
         /// <br/>
         /// If the command execution fails, a custom event called CommandFailure event is getting called.<br/>
         /// The arguments are: <see cref="Player"/> executor, <see cref="CommandFailure"/> failure, <see cref="string"/> line, <see cref="string"/> commandName
         /// </summary>
         /// <param name="name">The name of the command</param>
-        /// <param name="line">The data in form of a line of text</param>
+        /// <param name="tokens">The arguments of the command as they were split by the native side</param>
         /// <param name="playerId">The player id which executed the command</param>
-        internal void ExecuteCommand(string name, string line, int playerId)
+        internal void ExecuteCommand(string name, string[] tokens, int playerId)
         {
             try
             {
@@ -121,24 +127,23 @@ namespace Onsharp.Commands
                 Command command = GetCommand(name);
                 if (command == null)
                 {
-                    _server.CallEventUnsafely("CommandFailure", player, CommandFailure.NoCommand, line, name);
+                    _server.CallEventUnsafely("CommandFailure", player, CommandFailure.NoCommand, string.Join(" ", tokens), name);
                     return;
                 }
 
                 if (!string.IsNullOrEmpty(command.Permission) && !player.HasPermission(command.Permission))
                 {
-                    _server.CallEventUnsafely("CommandFailure", player, CommandFailure.NoPermissions, line, name);
+                    _server.CallEventUnsafely("CommandFailure", player, CommandFailure.NoPermissions, string.Join(" ", tokens), name);
                     return;
                 }
                 
-                List<string> strArgs = new List<string>();
+                List<string> strArgs = new List<string>(tokens.Length);
                 string currentStr = null;
                 string openingChar = "";
 
                 #region Greedy String Formatting
                 
-                string[] parts = line.Trim().Split(' ');
-                foreach (string str in parts)
+                foreach (string str in tokens)
                 {
                     if(string.IsNullOrEmpty(str?.Trim())) continue;
                     if (currentStr == null)
@@ -195,7 +200,7 @@ namespace Onsharp.Commands
                     int requiredParams = parameters.Count(info => !info.IsOptional) - 1;
                     if (requiredParams > strArgs.Count)
                     {
-                        _server.CallEventUnsafely("CommandFailure", player, CommandFailure.TooFewArgs, line, name);
+                        _server.CallEventUnsafely("CommandFailure", player, CommandFailure.TooFewArgs, string.Join(" ", tokens), name);
                         return;
                     }
 
@@ -207,7 +212,7 @@ namespace Onsharp.Commands
             catch (Exception ex)
             {
                 _server.Owner.Plugin.Logger.Error(ex,
-                    "An error occurred while executing an command with line \"{LINE}\" for player {ID}!", line,
+                    "An error occurred while executing an command with line \"{LINE}\" for player {ID}!", string.Join(" ", tokens),
                     playerId);
             }
         }
@@ -18,7 +18,7 @@ namespace Onsharp.Entities
         /// </summary>
         public int Model => Onset.GetDoorModel(Id);
         
-        public Door(int id) : base(id, "Door")
+        public Door(int id) : base(id, EntityType.Door)
         {
         }
     }
@@ -1,5 +1,6 @@
 ﻿using System.Collections.Generic;
 using Onsharp.Enums;
+using Onsharp.Interop;
 using Onsharp.Native;
 using Onsharp.World;
 
@@ -27,14 +28,14 @@ namespace Onsharp.Entities
         /// </summary>
         public Dimension Dimension
         {
-            get => Owner.GetDimension(Onset.GetEntityDimension(EntityName, Id));
-            set => Onset.SetEntityDimension(EntityName, Id, value.Value);
+            get => Owner.GetDimension(Onset.GetEntityDimension(EntityType, Id));
+            set => Onset.SetEntityDimension(EntityType, Id, value.Value);
         }
 
         /// <summary>
-        /// The entity name of the entity which will be needed for calling specific native methods.
+        /// The entity type of the entity which will be needed for calling specific native methods.
         /// </summary>
-        internal string EntityName { get; }
+        internal EntityType EntityType { get; }
         
         internal Server Owner { get; set; }
         
@@ -42,10 +43,10 @@ namespace Onsharp.Entities
 
         private readonly Dictionary<string, object> _localData;
 
-        internal Entity(int id, string entityName)
+        internal Entity(int id, EntityType entityType)
         {
             Id = id;
-            EntityName = entityName;
+            EntityType = entityType;
             _localData = new Dictionary<string, object>();
         }
 
@@ -66,7 +67,7 @@ namespace Onsharp.Entities
         /// <param name="z">The z axis value</param>
         public virtual void SetPosition(double x, double y, double z)
         {
-            Onset.SetEntityPosition(Id, EntityName, x, y, z);
+            Onset.SetEntityPosition(Id, EntityType, x, y, z);
         }
         
         /// <summary>
@@ -76,7 +77,7 @@ namespace Onsharp.Entities
         public virtual Vector GetPosition()
         {
             double x = 0, y = 0, z = 0;
-            Onset.GetEntityPosition(Id, EntityName, ref x, ref y, ref z);
+            Onset.GetEntityPosition(Id, EntityType, ref x, ref y, ref z);
             Vector vector = new Vector(x, y, z);
             vector.SyncCallback = () => SetPosition(vector);
             return vector;
@@ -93,14 +94,30 @@ namespace Onsharp.Entities
 
         /// <summary>
         /// Sets the property value for the given name of the entity.
+        /// The value is kept by the native runtime and only written to the Lua property system of Onset if it gets synced.
+        /// A synced value replaces the native one, so properties which are also written by Lua packages must be synced.
         /// </summary>
         /// <param name="name">The name of the property</param>
         /// <param name="value">The value to be set to</param>
-        /// <param name="sync">Whether the value should be synced to the clients or not</param>
+        /// <param name="sync">Whether the value should be synced to the clients and the Lua packages or not</param>
         public void SetPropertyValue(string name, object value, bool sync = false)
         {
             NativeValue nVal = Bridge.CreateNValue(value);
-            Onset.SetPropertyValue(EntityName, Id, name, nVal.NativePtr, sync);
+            Onset.SetPropertyValue(EntityType, Id, name, nVal.NativePtr, sync);
+            if (!(value is LuaTable))
+            {
+                nVal.Dispose();
+            }
+        }
+
+        /// <summary>
+        /// Sets whether this entity is written to the world snapshots and brought back after a crash of the server.
+        /// Only vehicles, objects and NPCs can be persistent, entities which are created again at every start should not.
+        /// </summary>
+        /// <param name="persistent">True if the entity should be restored after a crash</param>
+        public void SetPersistent(bool persistent)
+        {
+            Onset.SetEntityPersistent(EntityType, Id, persistent);
         }
 
         /// <summary>
@@ -159,7 +176,14 @@ namespace Onsharp.Entities
         /// <returns>The default value</returns>
         public object GetPropertyValue(string name)
         {
-            return new NativeValue(Onset.GetPropertyValue(EntityName, Id, name)).GetValue();
+            NativeValue nVal = new NativeValue(Onset.GetPropertyValue(EntityType, Id, name));
+            object val = nVal.GetValue();
+            if (!(val is LuaTable))
+            {
+                nVal.Dispose();
+            }
+
+            return val;
         }
 
         /// <summary>
@@ -2,6 +2,7 @@
 using System.Collections.Generic;
 using System.Linq;
 using System.Runtime.InteropServices;
+using Onsharp.Entities.Factory;
 using Onsharp.Native;
 
 namespace Onsharp.Entities
@@ -12,21 +13,21 @@ namespace Onsharp.Entities
     internal class EntityPool
     {
         private readonly List<Entity> _entities;
-        private readonly string _entityName;
+        private readonly EntityType _entityType;
         private readonly Func<int, Entity> _creator;
         private readonly Server _server;
         
-        public EntityPool(Server server, string entityName, Func<int, Entity> creator)
+        public EntityPool(Server server, EntityType entityType, Func<int, Entity> creator)
         {
             _server = server;
-            _entityName = entityName;
+            _entityType = entityType;
             _creator = creator;
             _entities = new List<Entity>();
         }
 
         internal bool Validate(Entity entity)
         {
-            if (Onset.IsEntityValid(entity.Id, entity.EntityName))
+            if (Onset.IsEntityValid(entity.Id, entity.EntityType))
                 return true;
             RemoveEntity(entity);
             return false;
@@ -38,7 +39,8 @@ namespace Onsharp.Entities
                 _entities.Remove(entity);
         }
 
-        internal T GetEntity<T>(int id, Func<T> creator) where T : Entity
+        // the factory is passed instead of a creating closure, so finding an existing entity allocates nothing
+        internal T GetEntity<T>(int id, IEntityFactory<T> factory) where T : Entity
         {
             lock (_entities)
             {
@@ -51,7 +53,7 @@ namespace Onsharp.Entities
                     }
                 }
 
-                T newEntity = creator.Invoke();
+                T newEntity = factory.Create(id);
                 newEntity.Pool = this;
                 newEntity.Owner = _server;
                 _entities.Add(newEntity);
@@ -59,6 +61,23 @@ namespace Onsharp.Entities
             }
         }
         
+        /// <summary>
+        /// Returns all entities of this pool's type which currently exist on the server.
+        /// The ids are enumerated from the native entity registry.
+        /// </summary>
+        internal IReadOnlyList<T> GetAllEntities<T>() where T : Entity
+        {
+            int[] ids = new int[Onset.GetEntityCount(_entityType)];
+            int count = Math.Min(Onset.GetEntities(_entityType, ids, ids.Length), ids.Length);
+            List<T> entities = new List<T>(count);
+            for (int i = 0; i < count; i++)
+            {
+                entities.Add((T) _creator.Invoke(ids[i]));
+            }
+
+            return entities.AsReadOnly();
+        }
+        
         internal IReadOnlyList<T> CastEntities<T>() where T : Entity
         {
             lock (_entities)
@@ -7,7 +7,7 @@ namespace Onsharp.Entities
     /// </summary>
     public abstract class LifelessEntity : Entity
     {
-        protected LifelessEntity(int id, string entityName) : base(id, entityName)
+        internal LifelessEntity(int id, EntityType entityType) : base(id, entityType)
         {
         }
 
@@ -17,7 +17,7 @@ namespace Onsharp.Entities
         public void Destroy()
         {
             Pool.RemoveEntity(this);
-            Onset.DestroyEntity(EntityName, Id);
+            Onset.DestroyEntity(EntityType, Id);
         }
     }
 }
\ No newline at end of file
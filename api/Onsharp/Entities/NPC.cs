@@ -24,7 +24,12 @@ namespace Onsharp.Entities
             set => Onset.SetNPCHeading(Id, value);
         }
 
-        public NPC(int id) : base(id, "NPC")
+        /// <summary>
+        /// The commonly read values of the NPC, read in one call instead of one call per value.
+        /// </summary>
+        public NPCStatus Status => Onset.GetNPCStatus(Id);
+
+        public NPC(int id) : base(id, EntityType.NPC)
         {
         }
 
@@ -44,7 +49,7 @@ namespace Onsharp.Entities
         /// <returns>True, if the NPC is streamed in for the player</returns>
         public bool IsStreamedFor(Player player)
         {
-            return Onset.IsStreamedIn(EntityName, player.Id, Id);
+            return Onset.IsStreamedIn(EntityType, player.Id, Id);
         }
 
         /// <summary>
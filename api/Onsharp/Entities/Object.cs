@@ -62,7 +62,7 @@ namespace Onsharp.Entities
             set => Onset.SetObjectModel(Id, value);
         }
         
-        public Object(int id) : base(id, "Object")
+        public Object(int id) : base(id, EntityType.Object)
         {
         }
 
@@ -73,7 +73,7 @@ namespace Onsharp.Entities
         /// <returns>True, if the object is streamed in for the player</returns>
         public bool IsStreamedIn(Player player)
         {
-            return Onset.IsStreamedIn(EntityName, player.Id, Id);
+            return Onset.IsStreamedIn(EntityType, player.Id, Id);
         }
 
         /// <summary>
@@ -161,7 +161,7 @@ namespace Onsharp.Entities
         /// <returns>True, if the object is streamed in for the player</returns>
         public bool IsStreamedFor(Player player)
         {
-            return Onset.IsStreamedIn(EntityName, player.Id, Id);
+            return Onset.IsStreamedIn(EntityType, player.Id, Id);
         }
 
         /// <summary>
@@ -25,7 +25,7 @@ namespace Onsharp.Entities
             set => Onset.SetPickupScale(Id, value.X, value.Y, value.Z);
         }
         
-        public Pickup(int id) : base(id, "Pickup")
+        public Pickup(int id) : base(id, EntityType.Pickup)
         {
         }
 
@@ -17,7 +17,7 @@ namespace Onsharp.Entities
         /// </summary>
         public string Name
         {
-            get => Bridge.PtrToString(Onset.GetPlayerName(Id));
+            get => Onset.GetPlayerName(Id);
             set => Onset.SetPlayerName(Id, value);
         }
 
@@ -26,6 +26,17 @@ namespace Onsharp.Entities
         /// </summary>
         public NetworkStats NetworkStats => Bridge.GetNetworkStats(Id);
 
+        /// <summary>
+        /// Aggregates the network stats of the player which the native runtime sampled periodically, without querying Onset.
+        /// </summary>
+        /// <param name="field">The sampled value which should be aggregated</param>
+        /// <param name="window">The count of latest samples to aggregate, 0 takes all kept samples</param>
+        /// <returns>The aggregated samples</returns>
+        public NetworkStatSummary GetNetworkStatSummary(NetworkStatField field, int window = 0)
+        {
+            return Bridge.GetNetworkStatSummary(Id, field, window);
+        }
+
         /// <summary>
         /// A list containing all vehicles that are currently streamed for the player.
         /// </summary>
@@ -176,13 +187,18 @@ namespace Onsharp.Entities
         /// <summary>
         /// The internet IP of the player.
         /// </summary>
-        public string IP => Bridge.PtrToString(Onset.GetPlayerIP(Id));
+        public string IP => Onset.GetPlayerIP(Id);
 
         /// <summary>
         /// The ping of the player.
         /// </summary>
         public int Ping => Onset.GetPlayerPing(Id);
 
+        /// <summary>
+        /// The commonly read values of the player, read in one call instead of one call per value.
+        /// </summary>
+        public PlayerStatus Status => Onset.GetPlayerStatus(Id);
+
         /// <summary>
         /// The game version of the player.
         /// </summary>
@@ -191,12 +207,12 @@ namespace Onsharp.Entities
         /// <summary>
         /// The player's game locale.
         /// </summary>
-        public string Locale => Bridge.PtrToString(Onset.GetPlayerLocale(Id));
+        public string Locale => Onset.GetPlayerLocale(Id);
         
         /// <summary>
         /// The player's system's GUID.
         /// </summary>
-        public string GUID => Bridge.PtrToString(Onset.GetPlayerGUID(Id));
+        public string GUID => Onset.GetPlayerGUID(Id);
  
         /// <summary>
         /// The status of the player in association of the given voice channel.
@@ -231,7 +247,7 @@ namespace Onsharp.Entities
         /// </summary>
         private readonly List<string> _permissions;
 
-        public Player(int id) : base(id, "Player")
+        public Player(int id) : base(id, EntityType.Player)
         {
             _permissions = new List<string>();
         }
@@ -299,25 +315,43 @@ namespace Onsharp.Entities
         /// Calls a remote event handler on the client-side of this player.
         /// </summary>
         /// <param name="name">The name of the remote event handler which should be called</param>
-        /// <param name="args">The arguments which will passed to the event handler. The maximum length is 10</param>
+        /// <param name="args">The arguments which will passed to the event handler. The maximum length is 14</param>
         public void CallRemote(string name, params object[] args)
         {
-            if(args.Length > 14)
-                throw new ArgumentException("The maximum length of event handler arguments is 14!");
-
-            IntPtr[] argsArr = new IntPtr[args.Length];
-            for (int i = 0; i < args.Length; i++)
-            {
-                object arg = args[i];
-                if (arg is Entity entity)
-                {
-                    arg = entity.Id;
-                }
-                
-                argsArr[i] = Bridge.CreateNValue(arg).NativePtr;
-            }
-            
+            IntPtr[] argsArr = Bridge.CreateRemoteArgs(args);
             Onset.CallRemote(Id, name, argsArr, argsArr.Length);
+            Bridge.FreeNValues(args, argsArr);
+        }
+        
+        /// <summary>
+        /// Queues a remote event for the client-side of this player. All queued events of a player are sent
+        /// together as one packed remote event at the end of the current tick.<br/>
+        /// <br/>
+        /// The onsharp client package unpacks the batch and calls the events in order. The client-side handlers must
+        /// be added with the AddRemoteEvent export of the onsharp package instead of AddRemoteEvent. Batches which
+        /// the client does not acknowledge are sent again until they expire.
+        /// </summary>
+        /// <param name="name">The name of the event which should be called</param>
+        /// <param name="args">The arguments which will passed to the event handler. The maximum length is 14</param>
+        public void QueueRemote(string name, params object[] args)
+        {
+            IntPtr[] argsArr = Bridge.CreateRemoteArgs(args);
+            Onset.QueueRemote(Id, name, argsArr, argsArr.Length, false);
+            Bridge.FreeNValues(args, argsArr);
+        }
+        
+        /// <summary>
+        /// Queues a state update for the client-side of this player like <see cref="QueueRemote"/> does.
+        /// If a state update with the same name is already queued in this tick, it is replaced, so only the
+        /// latest state is sent.
+        /// </summary>
+        /// <param name="name">The name of the event which should be called</param>
+        /// <param name="args">The arguments which will passed to the event handler. The maximum length is 14</param>
+        public void QueueRemoteState(string name, params object[] args)
+        {
+            IntPtr[] argsArr = Bridge.CreateRemoteArgs(args);
+            Onset.QueueRemote(Id, name, argsArr, argsArr.Length, true);
+            Bridge.FreeNValues(args, argsArr);
         }
         
         /// <summary>
@@ -371,7 +405,7 @@ namespace Onsharp.Entities
         /// <returns>True, if the player is streamed in for the given player</returns>
         public bool IsStreamedFor(Player player)
         {
-            return Onset.IsStreamedIn(EntityName, player.Id, Id);
+            return Onset.IsStreamedIn(EntityType, player.Id, Id);
         }
 
         /// <summary>
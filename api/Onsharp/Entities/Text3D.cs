@@ -23,7 +23,7 @@ namespace Onsharp.Entities
 
         internal string InternalText { get; set; }
         
-        public Text3D(int id) : base(id, "Text3D")
+        public Text3D(int id) : base(id, EntityType.Text3D)
         {
         }
 
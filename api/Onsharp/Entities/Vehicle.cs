@@ -13,7 +13,7 @@ namespace Onsharp.Entities
         /// </summary>
         public string LicensePlate
         {
-            get => Bridge.PtrToString(Onset.GetVehicleLicensePlate(Id));
+            get => Onset.GetVehicleLicensePlate(Id);
             set => Onset.SetVehicleLicensePlate(Id, value);
         }
 
@@ -26,6 +26,11 @@ namespace Onsharp.Entities
             set => Onset.SetVehicleHeading(Id, value);
         }
 
+        /// <summary>
+        /// The commonly read values of the vehicle, read in one call instead of one call per value.
+        /// </summary>
+        public VehicleStatus Status => Onset.GetVehicleStatus(Id);
+
         /// <summary>
         /// The health of the vehicle.
         /// </summary>
@@ -137,7 +142,7 @@ namespace Onsharp.Entities
         /// <summary>
         /// The model name of the vehicle.
         /// </summary>
-        public string ModelName => Bridge.PtrToString(Onset.GetVehicleModelName(Id));
+        public string ModelName => Onset.GetVehicleModelName(Id);
 
         /// <summary>
         /// The maximal number of seats of the vehicle.
@@ -172,7 +177,7 @@ namespace Onsharp.Entities
             }
         }
         
-        public Vehicle(int id) : base(id, "Vehicle")
+        public Vehicle(int id) : base(id, EntityType.Vehicle)
         {
         }
         
@@ -195,7 +200,7 @@ namespace Onsharp.Entities
         /// <returns>True, if the vehicle is streamed in for the player</returns>
         public bool IsStreamedFor(Player player)
         {
-            return Onset.IsStreamedIn(EntityName, player.Id, Id);
+            return Onset.IsStreamedIn(EntityType, player.Id, Id);
         }
         
         /// <summary>
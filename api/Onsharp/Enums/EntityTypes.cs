@@ -0,0 +1,13 @@
+﻿using System;
+
+namespace Onsharp.Enums
+{
+    /// <summary>
+    /// All entity types which are covered by the spatial queries of a dimension.
+    /// </summary>
+    [Flags]
+    public enum EntityTypes
+    {
+        None = 0, Player = 1, Vehicle = 2, NPC = 4, Object = 8, Pickup = 16, All = Player | Vehicle | NPC | Object | Pickup
+    }
+}
@@ -1,4 +1,6 @@
 ﻿using System;
+using System.Linq;
+using System.Linq.Expressions;
 using System.Reflection;
 
 namespace Onsharp.Events
@@ -25,6 +27,7 @@ namespace Onsharp.Events
         
         private MethodInfo _handler;
         private object _owner;
+        private Delegate _typedHandler;
 
         /// <summary>
         /// The default constructor. This constructor is for default event listening.
@@ -53,6 +56,37 @@ namespace Onsharp.Events
         {
             _handler = handler;
             _owner = owner;
+            _typedHandler = CreateTypedHandler(owner, handler);
+        }
+
+        /// <summary>
+        /// Binds the handler to a Func or an Action of its parameters, so the events with a typed fast path can call it
+        /// without boxing the arguments.
+        /// </summary>
+        /// <returns>The bound handler or null if it cannot be bound</returns>
+        private static Delegate CreateTypedHandler(object owner, MethodInfo handler)
+        {
+            ParameterInfo[] parameters = handler.GetParameters();
+            if (parameters.Length == 0 || parameters.Length > 7 || parameters.Any(parameter => parameter.ParameterType.IsByRef))
+                return null;
+
+            Type[] types = parameters.Select(parameter => parameter.ParameterType).ToArray();
+            Type delegateType;
+            if (handler.ReturnType == typeof(bool))
+                delegateType = Expression.GetFuncType(types.Append(typeof(bool)).ToArray());
+            else if (handler.ReturnType == typeof(void))
+                delegateType = Expression.GetActionType(types);
+            else
+                return null;
+
+            try
+            {
+                return owner == null ? handler.CreateDelegate(delegateType) : handler.CreateDelegate(delegateType, owner);
+            }
+            catch (ArgumentException)
+            {
+                return null;
+            }
         }
 
         /// <summary>
@@ -64,5 +98,53 @@ namespace Onsharp.Events
         {
             return _handler.Invoke(_owner, args) as bool? ?? true;
         }
+
+        internal bool FireEvent<T1>(T1 arg1)
+        {
+            if (_typedHandler is Func<T1, bool> func) return func(arg1);
+            if (_typedHandler is Action<T1> action)
+            {
+                action(arg1);
+                return true;
+            }
+
+            return FireEvent(new object[] {arg1});
+        }
+
+        internal bool FireEvent<T1, T2>(T1 arg1, T2 arg2)
+        {
+            if (_typedHandler is Func<T1, T2, bool> func) return func(arg1, arg2);
+            if (_typedHandler is Action<T1, T2> action)
+            {
+                action(arg1, arg2);
+                return true;
+            }
+
+            return FireEvent(new object[] {arg1, arg2});
+        }
+
+        internal bool FireEvent<T1, T2, T3>(T1 arg1, T2 arg2, T3 arg3)
+        {
+            if (_typedHandler is Func<T1, T2, T3, bool> func) return func(arg1, arg2, arg3);
+            if (_typedHandler is Action<T1, T2, T3> action)
+            {
+                action(arg1, arg2, arg3);
+                return true;
+            }
+
+            return FireEvent(new object[] {arg1, arg2, arg3});
+        }
+
+        internal bool FireEvent<T1, T2, T3, T4, T5, T6, T7>(T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            if (_typedHandler is Func<T1, T2, T3, T4, T5, T6, T7, bool> func) return func(arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+            if (_typedHandler is Action<T1, T2, T3, T4, T5, T6, T7> action)
+            {
+                action(arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+                return true;
+            }
+
+            return FireEvent(new object[] {arg1, arg2, arg3, arg4, arg5, arg6, arg7});
+        }
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 using System.Collections.Generic;
 using System.IO;
 using System.Reflection;
+using System.Text;
 using Nett;
 using Onsharp.Native;
 using Onsharp.Plugins;
@@ -12,6 +13,8 @@ namespace Onsharp.IO
     {
         private readonly List<object> _cache;
         private readonly string _path;
+        private readonly object _storeLock = new object();
+        private int _store;
 
         public DirectoryInfo Directory { get; }
 
@@ -67,5 +70,69 @@ namespace Onsharp.IO
                 _cache.Add(readConfig);
             return readConfig;
         }
+
+        public void Store<T>(string key, T value)
+        {
+            StoreBytes(key, Encoding.UTF8.GetBytes(Json.ToJson(value)));
+        }
+
+        public T Load<T>(string key, T @default = default)
+        {
+            byte[] value = LoadBytes(key);
+            return value == null ? @default : Json.FromJson<T>(Encoding.UTF8.GetString(value));
+        }
+
+        public void StoreBytes(string key, byte[] value)
+        {
+            Onset.PutStoreValue(GetStore(), key, value);
+        }
+
+        public byte[] LoadBytes(string key)
+        {
+            return Onset.GetStoreValue(GetStore(), key);
+        }
+
+        public void Delete(string key)
+        {
+            Onset.RemoveStoreValue(GetStore(), key);
+        }
+
+        public void Flush()
+        {
+            lock (_storeLock)
+            {
+                if (_store > 0 && !Onset.FlushStore(_store))
+                    throw new IOException($"The key value store in {_path} could not commit all values!");
+            }
+        }
+
+        /// <summary>
+        /// Closes the key value store after committing all pending writes.
+        /// </summary>
+        internal void Close()
+        {
+            lock (_storeLock)
+            {
+                if (_store <= 0) return;
+                if (!Onset.CloseStore(_store))
+                    Bridge.Logger.Warn("The key value store in {PATH} lost values which could not be committed!", _path);
+                _store = 0;
+            }
+        }
+
+        /// <summary>
+        /// Opens the native key value store of this data storage on first use.
+        /// </summary>
+        private int GetStore()
+        {
+            lock (_storeLock)
+            {
+                if (_store > 0) return _store;
+                _store = Onset.OpenStore(Path.Combine(_path, "data.kv"));
+                if (_store <= 0)
+                    throw new IOException($"The key value store in {_path} could not be opened!");
+                return _store;
+            }
+        }
     }
 }
\ No newline at end of file
@@ -26,5 +26,49 @@ namespace Onsharp.IO
         /// <typeparam name="T">The type of the config</typeparam>
         /// <returns>The config object</returns>
         T Config<T>();
+
+        /// <summary>
+        /// Stores the given value as JSON under the given key in the key value store of this data storage.
+        /// The write is committed to the disk in the background, the value can be loaded again right away.
+        /// </summary>
+        /// <param name="key">The key of the value</param>
+        /// <param name="value">The value to be stored</param>
+        /// <typeparam name="T">The type of the value</typeparam>
+        void Store<T>(string key, T value);
+
+        /// <summary>
+        /// Loads the value stored under the given key from the key value store of this data storage.
+        /// </summary>
+        /// <param name="key">The key of the value</param>
+        /// <param name="default">The default value if nothing is stored under the key</param>
+        /// <typeparam name="T">The type of the value</typeparam>
+        /// <returns>The stored value or the default value</returns>
+        T Load<T>(string key, T @default = default);
+
+        /// <summary>
+        /// Stores the given raw bytes under the given key in the key value store of this data storage.
+        /// </summary>
+        /// <param name="key">The key of the value</param>
+        /// <param name="value">The bytes to be stored</param>
+        void StoreBytes(string key, byte[] value);
+
+        /// <summary>
+        /// Loads the raw bytes stored under the given key from the key value store of this data storage.
+        /// </summary>
+        /// <param name="key">The key of the value</param>
+        /// <returns>The stored bytes or null if nothing is stored under the key</returns>
+        byte[] LoadBytes(string key);
+
+        /// <summary>
+        /// Deletes the value stored under the given key from the key value store of this data storage.
+        /// </summary>
+        /// <param name="key">The key of the value</param>
+        void Delete(string key);
+
+        /// <summary>
+        /// Blocks until every value stored so far is committed to the disk.
+        /// Throws an <see cref="System.IO.IOException"/> if the values could not be committed.
+        /// </summary>
+        void Flush();
     }
 }
\ No newline at end of file
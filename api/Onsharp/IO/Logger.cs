@@ -1,6 +1,5 @@
 ﻿using System;
 using System.IO;
-using System.Threading;
 using Onsharp.Native;
 using Serilog;
 using Serilog.Core;
@@ -66,48 +65,23 @@ namespace Onsharp.IO
             _isDebug = enabled;
         }
 
+        /// <summary>
+        /// Hands the rendered log events over to the native log ring which writes them into the daily log file of
+        /// the logger on its own thread. The console output is still done by serilog.
+        /// </summary>
         private class EventLogSink : ILogEventSink
         {
-            private readonly ReaderWriterLock _locker = new ReaderWriterLock();
-            private readonly Logger _parent;
+            private readonly int _sink;
 
             internal EventLogSink(Logger parent)
             {
-                _parent = parent;
+                _sink = Onset.RegisterLogSink(parent._path);
             }
 
             public void Emit(LogEvent logEvent)
             {
-                string line = $"[{DateTime.Now:hh:mm:ss} {LevelToSeverity(logEvent)}] " + logEvent.RenderMessage();
-                try
-                {
-                    _locker.AcquireWriterLock(int.MaxValue);
-                    File.AppendAllLines(Path.Combine(_parent._path, DateTime.Today.ToString("dd_MM_yyyy") + ".txt"), new[] { line });
-                }
-                finally
-                {
-                    _locker.ReleaseWriterLock();
-                }
-            }
-
-            private string LevelToSeverity(LogEvent logEvent)
-            {
-                switch (logEvent.Level)
-                {
-                    case LogEventLevel.Debug:
-                        return "DBG";
-                    case LogEventLevel.Error:
-                        return "ERR";
-                    case LogEventLevel.Fatal:
-                        return "FTL";
-                    case LogEventLevel.Verbose:
-                        return "VRB";
-                    case LogEventLevel.Warning:
-                        return "WRN";
-                    default:
-                        return "INF";
-                }
+                Onset.WriteLog(_sink, (int) logEvent.Level, false, logEvent.RenderMessage());
             }
         }
     }
-}
\ No newline at end of file
+}
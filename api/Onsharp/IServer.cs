@@ -36,6 +36,14 @@ namespace Onsharp
         /// The current statistics of the network.
         /// </summary>
         NetworkStats NetworkStats { get; }
+
+        /// <summary>
+        /// Aggregates the network stats which the native runtime sampled periodically, without querying Onset.
+        /// </summary>
+        /// <param name="field">The sampled value which should be aggregated</param>
+        /// <param name="window">The count of latest samples to aggregate, 0 takes all kept samples</param>
+        /// <returns>The aggregated samples</returns>
+        NetworkStatSummary GetNetworkStatSummary(NetworkStatField field, int window = 0);
         
         /// <summary>
         /// Returns the wrapped dimension from the given id. 
@@ -169,6 +177,14 @@ namespace Onsharp
         /// </summary>
         void ShutdownServer();
 
+        /// <summary>
+        /// Calls a remote event handler on the client-side of every player on the server.
+        /// The arguments are converted only once for all players.
+        /// </summary>
+        /// <param name="name">The name of the remote event handler which should be called</param>
+        /// <param name="args">The arguments which will passed to the event handler. The maximum length is 14</param>
+        void CallRemote(string name, params object[] args);
+
         /// <summary>
         /// Returns the wrapped dimension object to the given id.
         /// </summary>
@@ -230,6 +246,17 @@ namespace Onsharp
         /// <param name="heading">The heading of the vehicle</param>
         /// <returns>The wrapped vehicle object</returns>
         Vehicle CreateVehicle(VehicleModel model, Vector pos, double heading = 0);
+
+        /// <summary>
+        /// Spawns the objects, pickups, 3D texts and doors of the given world layout file in the global dimension.
+        /// The runtime spawns the layout in chunks over the next ticks and does not fire the created events
+        /// for these entities.
+        /// </summary>
+        /// <param name="path">The path to the layout file written by <see cref="WorldLayout.Save"/></param>
+        /// <param name="onLoaded">The callback which gets the spawned entities in the order of the layout, entries which could not be spawned are null</param>
+        /// <param name="perTick">The maximum amount of entities spawned per tick</param>
+        /// <returns>False, if the file is no valid world layout</returns>
+        bool LoadLayout(string path, Action<IReadOnlyList<Entity>> onLoaded = null, int perTick = 500);
         
         /// <summary>
         /// Adds the given callback to the task queue of the main thread. When the task queue is getting proceed
@@ -17,9 +17,7 @@ namespace Onsharp.Interop
          public int Add(int val1, int val2);
          
          LUA:
-         local add = ImportOnsharpFunc("test-plugin", "add");
-         
-         local sum = add(1, 1);
+         local sum = CallOnsharp("test-plugin", "add", 1, 1);
          */
         
         /// <summary>
@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Collections.Generic;
 using System.Text.RegularExpressions;
 using Onsharp.Native;
 
@@ -11,7 +12,23 @@ namespace Onsharp.Interop
     /// </summary>
     public class LuaPackage
     {
+        /// <summary>
+        /// The maximum count of return values which are read back from an invoked function.
+        /// </summary>
+        private const int MaxReturnValues = 16;
+
+        /// <summary>
+        /// The value returned by the runtime when a cached handle got released because its package stopped.
+        /// </summary>
+        private const int ReleasedHandle = -2;
+        
+        /// <summary>
+        /// The id under which the package is imported on the Lua side.
+        /// </summary>
+        internal string ImportId => _importId;
+        
         private readonly string _importId;
+        private readonly Dictionary<string, int> _handles = new Dictionary<string, int>();
         
         /// <summary>
         /// The default constructor which passes the needed meta information to generate the import id.
@@ -58,20 +75,68 @@ namespace Onsharp.Interop
         /// <returns>An array of object as return values</returns>
         public object[] InvokeMultiple(string funcName, params object[] args)
         {
+            int handle = GetHandle(funcName);
+            if (handle < 0)
+            {
+                Bridge.Logger.Warn("The function {FUNC} could not be resolved in the imported package {ID}!", funcName, _importId);
+                return new object[0];
+            }
+            
             IntPtr[] nVals = new IntPtr[args.Length];
             for (int i = 0; i < args.Length; i++)
             {
                 nVals[i] = Bridge.CreateNValue(args[i]).NativePtr;
             }
 
-            IntPtr[] rVals = Onset.InvokePackage(_importId, funcName, nVals, args.Length);
-            object[] rArgs = new object[rVals.Length];
-            for (int i = 0; i < rVals.Length; i++)
+            IntPtr[] rVals = new IntPtr[MaxReturnValues];
+            int count = Onset.InvokePackageFunction(handle, nVals, nVals.Length, rVals, rVals.Length);
+            if (count == ReleasedHandle)
             {
-                rArgs[i] = new NativeValue(rVals[i]).GetValue();
+                lock (_handles)
+                {
+                    _handles.Remove(funcName);
+                }
+
+                handle = GetHandle(funcName);
+                count = handle < 0 ? -1 : Onset.InvokePackageFunction(handle, nVals, nVals.Length, rVals, rVals.Length);
+            }
+            
+            Bridge.FreeNValues(args, nVals);
+            if (count <= 0) return new object[0];
+            
+            object[] rArgs = new object[Math.Min(count, MaxReturnValues)];
+            for (int i = 0; i < rArgs.Length; i++)
+            {
+                NativeValue nVal = new NativeValue(rVals[i]);
+                rArgs[i] = nVal.GetValue();
+                if (!(rArgs[i] is LuaTable))
+                {
+                    nVal.Dispose();
+                }
             }
             
             return rArgs;
         }
+
+        /// <summary>
+        /// Gets the native handle of the given function and resolves it once if it is not cached yet.
+        /// </summary>
+        /// <param name="funcName">The name of the wanted function</param>
+        /// <returns>The handle or a negative value if the function does not exist</returns>
+        private int GetHandle(string funcName)
+        {
+            lock (_handles)
+            {
+                if (_handles.TryGetValue(funcName, out int handle))
+                    return handle;
+                handle = Onset.ResolvePackageFunction(_importId, funcName);
+                if (handle >= 0)
+                {
+                    _handles.Add(funcName, handle);
+                }
+
+                return handle;
+            }
+        }
     }
 }
\ No newline at end of file
@@ -133,6 +133,11 @@ namespace Onsharp.Native
         /// </summary>
         internal static List<string> OccupiedCommandNames { get; private set; }
         
+        /// <summary>
+        /// The owning plugin id and the command name behind every native command handle.
+        /// </summary>
+        private static Dictionary<int, (string PluginId, string Name)> CommandHandles { get; set; }
+        
         /// <summary>
         /// A list which contains occupied console command names.
         /// </summary>
@@ -166,17 +171,23 @@ namespace Onsharp.Native
         
         private static readonly Onsharp.Service.IServiceProvider InternalServiceProvider = new ServiceProvider();
         private static readonly Converter DefaultConverter = new BasicConverter();
+        private static readonly Stack<List<PluginDomain>> EventDomainLists = new Stack<List<PluginDomain>>();
 
         /// <summary>
         /// Gets called by the native runtime when Onsharp should load itself.
         /// <param name="appPath">The path to the server given from the coreclr host</param>
+        /// <param name="nativeApi">The function table of the native runtime</param>
+        /// <param name="callbacks">The callback table which gets the managed entry points</param>
         /// </summary>
-        internal static void Load(string appPath)
+        internal static void Load(string appPath, IntPtr nativeApi, IntPtr callbacks)
         {
             try
             {
+                NativeApi.Load(nativeApi);
+                NativeApi.ExportCallbacks(callbacks);
                 TaskQueue = new List<Action>();
                 OccupiedCommandNames = new List<string>();
+                CommandHandles = new Dictionary<int, (string PluginId, string Name)>();
                 OccupiedConsoleCommandNames = new List<string>();
                 ServerPath = appPath;
                 AppPath = Path.Combine(ServerPath, "onsharp");
@@ -218,6 +229,28 @@ namespace Onsharp.Native
                 
                 Logger = new Logger("Onsharp", Config.IsDebug, "_global");
                 if(Config.IsDebug) Logger.Warn("{DEBUG}-Mode is currently active!", "DEBUG");
+                if (Config.RecordBridgeTraffic)
+                {
+                    string recordingPath = Path.Combine(LogPath, "recordings", $"bridge_{DateTime.Now:yyyyMMdd_HHmmss}.obr");
+                    IntPtr recordingApi = Onset.StartBridgeRecording(recordingPath, Config.BridgeRecordingLimit * 1024L * 1024L);
+                    if (recordingApi != IntPtr.Zero)
+                    {
+                        // from now on every native call goes through the recording table
+                        NativeApi.Load(recordingApi);
+                        Logger.Warn("The bridge traffic is recorded to {PATH}!", recordingPath);
+                    }
+                }
+
+                Onset.ConfigureNetworkSampler((float) Config.NetworkSampleInterval, Config.NetworkSampleSpreadTicks);
+                Onset.ConfigureTickMonitor(Config.SlowTickThreshold);
+                if (Config.RestoreWorldSnapshot)
+                {
+                    int restored = Onset.RestoreWorldSnapshot(500);
+                    if (restored > 0)
+                        Logger.Warn("Restoring {COUNT} entities from the world snapshot of the last crash...", restored);
+                }
+
+                Onset.ConfigureWorldSnapshots((float) Config.WorldSnapshotInterval);
                 ConsoleManager = new ConsoleManager();
                 Runtime = new Bridge();
                 ConsoleManager.Reset();
@@ -327,6 +360,20 @@ namespace Onsharp.Native
             }
         }
 
+        /// <summary>
+        /// Remembers which plugin and command the given native command handle belongs to.
+        /// </summary>
+        /// <param name="handle">The handle given by the native side</param>
+        /// <param name="pluginId">The id of the plugin owning the command</param>
+        /// <param name="name">The name of the command</param>
+        internal static void RegisterCommandHandle(int handle, string pluginId, string name)
+        {
+            lock (CommandHandles)
+            {
+                CommandHandles[handle] = (pluginId, name);
+            }
+        }
+
         /// <summary>
         /// Saves the admins to a file.
         /// </summary>
@@ -362,6 +409,201 @@ namespace Onsharp.Native
             return CreateNValue(HandleCalling(key, args)).NativePtr;
         }
 
+        /// <summary>
+        /// Gets called by the native runtime when a player shot their weapon. The arguments are passed as they are, so
+        /// the handlers taking the exact event arguments are called without boxing them.
+        /// </summary>
+        /// <param name="args">The arguments of the shot</param>
+        /// <returns>False as byte if a handler cancelled the hit</returns>
+        internal static unsafe byte CallWeaponShot(WeaponShotEvent* args)
+        {
+            bool flag = true;
+            List<PluginDomain> domains = null;
+            try
+            {
+                domains = CollectEventDomains();
+                for (int i = 0; i < domains.Count; i++)
+                {
+                    PluginDomain domain = domains[i];
+                    Server server = domain.Server;
+                    HitType hitType = (HitType) args->HitType;
+                    string traceName = BeginEventTrace(domain, EventType.PlayerWeaponShot);
+                    if (!server.CallEvent(EventType.PlayerWeaponShot, server.CreatePlayer(args->Player), (Weapon) args->Weapon,
+                        hitType, server.CreateHitEntity(hitType, args->HitId), new Vector(args->HitX, args->HitY, args->HitZ),
+                        new Vector(args->StartX, args->StartY, args->StartZ), new Vector(args->NormalX, args->NormalY, args->NormalZ)))
+                        flag = false;
+
+                    EndEventTrace(traceName);
+                }
+            }
+            catch (Exception ex)
+            {
+                Logger.Error(ex, "An error occurred while handling the event {EVENT} from the native side!", EventType.PlayerWeaponShot);
+            }
+            finally
+            {
+                if (domains != null)
+                    ReturnEventDomains(domains);
+            }
+
+            return NativeApi.FromBool(flag);
+        }
+
+        /// <summary>
+        /// Gets called by the native runtime when a player got damaged.
+        /// </summary>
+        /// <param name="args">The arguments of the damage</param>
+        /// <returns>False as byte if a handler cancelled the damage</returns>
+        internal static unsafe byte CallPlayerDamage(PlayerDamageEvent* args)
+        {
+            bool flag = true;
+            List<PluginDomain> domains = null;
+            try
+            {
+                domains = CollectEventDomains();
+                for (int i = 0; i < domains.Count; i++)
+                {
+                    PluginDomain domain = domains[i];
+                    Server server = domain.Server;
+                    string traceName = BeginEventTrace(domain, EventType.PlayerDamage);
+                    if (!server.CallEvent(EventType.PlayerDamage, server.CreatePlayer(args->Player), (DamageType) args->DamageType, args->Amount))
+                        flag = false;
+
+                    EndEventTrace(traceName);
+                }
+            }
+            catch (Exception ex)
+            {
+                Logger.Error(ex, "An error occurred while handling the event {EVENT} from the native side!", EventType.PlayerDamage);
+            }
+            finally
+            {
+                if (domains != null)
+                    ReturnEventDomains(domains);
+            }
+
+            return NativeApi.FromBool(flag);
+        }
+
+        /// <summary>
+        /// Gets called by the native runtime when a player or NPC got streamed in or out for a player.
+        /// </summary>
+        /// <param name="args">The arguments of the stream event</param>
+        internal static unsafe void CallStream(StreamEvent* args)
+        {
+            EventType type = (EventType) args->Type;
+            List<PluginDomain> domains = null;
+            try
+            {
+                domains = CollectEventDomains();
+                for (int i = 0; i < domains.Count; i++)
+                {
+                    PluginDomain domain = domains[i];
+                    Server server = domain.Server;
+                    Player player = server.CreatePlayer(args->Player);
+                    string traceName = BeginEventTrace(domain, type);
+                    if (type == EventType.NPCStreamIn || type == EventType.NPCStreamOut)
+                        server.CallEvent(type, player, server.CreateNPC(args->Entity));
+                    else
+                        server.CallEvent(type, player, server.CreatePlayer(args->Entity));
+
+                    EndEventTrace(traceName);
+                }
+            }
+            catch (Exception ex)
+            {
+                Logger.Error(ex, "An error occurred while handling the event {EVENT} from the native side!", type);
+            }
+            finally
+            {
+                if (domains != null)
+                    ReturnEventDomains(domains);
+            }
+        }
+
+        /// <summary>
+        /// Gets called by the native runtime on every game tick.
+        /// </summary>
+        /// <param name="delta">The seconds since the last tick</param>
+        internal static void CallGameTick(double delta)
+        {
+            List<PluginDomain> domains = null;
+            try
+            {
+                domains = CollectEventDomains();
+                for (int i = 0; i < domains.Count; i++)
+                {
+                    PluginDomain domain = domains[i];
+                    string traceName = BeginEventTrace(domain, EventType.GameTick);
+                    domain.Server.CallEvent(EventType.GameTick, delta);
+                    EndEventTrace(traceName);
+                }
+            }
+            catch (Exception ex)
+            {
+                Logger.Error(ex, "An error occurred while handling the event {EVENT} from the native side!", EventType.GameTick);
+            }
+            finally
+            {
+                if (domains != null)
+                    ReturnEventDomains(domains);
+            }
+        }
+
+        /// <summary>
+        /// Collects the domains of the running plugins in the order the events are passed to them. The typed event calls
+        /// all come from the main thread, but a handler can cause another one, so every call takes its own list from a
+        /// pool and gives it back by <see cref="ReturnEventDomains"/>.
+        /// </summary>
+        private static List<PluginDomain> CollectEventDomains()
+        {
+            List<PluginDomain> domains = EventDomainLists.Count > 0 ? EventDomainLists.Pop() : new List<PluginDomain>();
+            lock (PluginManager.Plugins)
+            {
+                for (int i = PluginManager.Plugins.Count - 1; i >= 0; i--)
+                {
+                    Plugin plugin = PluginManager.Plugins[i];
+                    if (plugin == null || plugin.State == PluginState.Failed) continue;
+                    PluginDomain domain = PluginManager.GetDomain(plugin);
+                    if (domain == null)
+                    {
+                        Logger.Fatal("Could not get plugin domain for loaded plugin {PLUGIN}!", plugin.Display);
+                        continue;
+                    }
+
+                    domains.Add(domain);
+                }
+            }
+
+            return domains;
+        }
+
+        /// <summary>
+        /// Gives a list of <see cref="CollectEventDomains"/> back to the pool.
+        /// </summary>
+        private static void ReturnEventDomains(List<PluginDomain> domains)
+        {
+            domains.Clear();
+            EventDomainLists.Push(domains);
+        }
+
+        /// <summary>
+        /// Begins the trace of the given event in the given plugin, if tracing is active.
+        /// </summary>
+        /// <returns>The name of the trace to end or null if none was begun</returns>
+        private static string BeginEventTrace(PluginDomain domain, EventType type)
+        {
+            if (!Onset.IsTraceActive()) return null;
+            string traceName = domain.Plugin.Meta.Id + ":" + type;
+            return Onset.TraceBegin(traceName) ? traceName : null;
+        }
+
+        private static void EndEventTrace(string traceName)
+        {
+            if (traceName != null)
+                Onset.TraceEnd(traceName);
+        }
+
         /// <summary>
         /// Handles the incoming calling from the native side.
         /// </summary>
@@ -377,6 +619,7 @@ namespace Onsharp.Native
 
                     bool consoleBreak = false;
                     bool flag = true;
+                    bool tracing = Onset.IsTraceActive();
                     PluginManager.IteratePlugins(plugin =>
                     {
                         if (plugin == null || plugin.State == PluginState.Failed) return;
@@ -388,8 +631,13 @@ namespace Onsharp.Native
                         }
 
                         object[] objArgs = ParseEventArgs(domain, type, args);
+                        string traceName = tracing ? plugin.Meta.Id + ":" + type : null;
+                        bool traced = tracing && Onset.TraceBegin(traceName);
                         if (!domain.Server.CallEvent(type, objArgs))
                             flag = false;
+                        
+                        if (traced)
+                            Onset.TraceEnd(traceName);
 
                         if (type == EventType.PlayerQuit)
                         {
@@ -442,20 +690,31 @@ namespace Onsharp.Native
 
                 if (key == "call-command")
                 {
-                    string pluginId = (string) args[0];
+                    int handle = System.Convert.ToInt32(args[0]);
                     int player = System.Convert.ToInt32(args[1]);
-                    string name = (string) args[2];
-                    string line = (string) args[3];
-                    if (pluginId == "native")
+                    string[] tokens = new string[args.Length - 2];
+                    for (int i = 2; i < args.Length; i++)
+                    {
+                        tokens[i - 2] = (string) args[i];
+                    }
+
+                    (string PluginId, string Name) command;
+                    lock (CommandHandles)
+                    {
+                        if (!CommandHandles.TryGetValue(handle, out command))
+                            return null;
+                    }
+                    
+                    if (command.PluginId == "native")
                     {
                         
                         return null;
                     }
                     
-                    Plugin plugin = PluginManager.GetPlugin(pluginId);
+                    Plugin plugin = PluginManager.GetPlugin(command.PluginId);
                     if (plugin != null)
                     {
-                        PluginManager.GetDomain(plugin)?.Server.FireCommand(player, name, line);
+                        PluginManager.GetDomain(plugin)?.Server.FireCommand(player, command.Name, tokens);
                     }
 
                     return null;
@@ -475,6 +734,12 @@ namespace Onsharp.Native
                     return null;
                 }
 
+                if (key == "call-layout")
+                {
+                    WorldLayout.OnLoaded(System.Convert.ToInt32(args[0]));
+                    return null;
+                }
+
                 if (key == "interop")
                 {
                     string pluginId = (string) args[0];
@@ -621,6 +886,20 @@ namespace Onsharp.Native
                 isLimitedByOutgoingBandwidthLimit);
         }
         
+        /// <summary>
+        /// Returns the aggregated samples of the native network stats sampler for the wanted source.
+        /// </summary>
+        /// <param name="source">The source can either be 0 and less, so its the server, or greater 0 than its a player</param>
+        /// <param name="field">The sampled value which should be aggregated</param>
+        /// <param name="window">The count of latest samples to aggregate, 0 and less takes all kept samples</param>
+        /// <returns>The aggregated samples</returns>
+        internal static NetworkStatSummary GetNetworkStatSummary(int source, NetworkStatField field, int window)
+        {
+            double min = 0, max = 0, avg = 0, p95 = 0;
+            int samples = Onset.GetNetworkStatsAggregate(source, (int) field, window, ref min, ref max, ref avg, ref p95);
+            return new NetworkStatSummary(samples, min, max, avg, p95);
+        }
+        
         /// <summary>
         /// Converts the given string list to an object parameter fitting array.
         /// </summary>
@@ -710,6 +989,46 @@ namespace Onsharp.Native
             return new NativeValue(Onset.CreateNValue());
         }
 
+        /// <summary>
+        /// Creates the native values for the arguments of a remote event. Entities are passed by their id.
+        /// </summary>
+        /// <param name="args">The arguments of the remote event. The maximum length is 14</param>
+        /// <returns>The pointers to the created native values</returns>
+        internal static IntPtr[] CreateRemoteArgs(object[] args)
+        {
+            if(args.Length > 14)
+                throw new ArgumentException("The maximum length of event handler arguments is 14!");
+
+            IntPtr[] nVals = new IntPtr[args.Length];
+            for (int i = 0; i < args.Length; i++)
+            {
+                object arg = args[i];
+                if (arg is Entity entity)
+                {
+                    arg = entity.Id;
+                }
+                
+                nVals[i] = CreateNValue(arg).NativePtr;
+            }
+
+            return nVals;
+        }
+
+        /// <summary>
+        /// Frees the native values which were created for the given arguments.
+        /// Values of <see cref="LuaTable"/>s are owned by the table and therefore kept alive.
+        /// </summary>
+        /// <param name="args">The arguments the native values were created from</param>
+        /// <param name="nVals">The pointers to the created native values</param>
+        internal static void FreeNValues(object[] args, IntPtr[] nVals)
+        {
+            for (int i = 0; i < nVals.Length; i++)
+            {
+                if (args[i] is LuaTable) continue;
+                Onset.FreeNValue(nVals[i]);
+            }
+        }
+
         /// <summary>
         /// Parses the given argument array from the bridge caller into event args which than can be passed to the event handler.
         /// WARNING: The first argument of the given array is the event type. Don't use it.
@@ -835,7 +1154,7 @@ namespace Onsharp.Native
 
         public int GameVersion => Onset.GetGameVersion();
         
-        public string GameVersionString => PtrToString(Onset.GetGameVersionAsString());
+        public string GameVersionString => Onset.GetGameVersionAsString();
 
         public double UptimeSeconds => Onset.GetTimeSeconds();
 
@@ -931,6 +1250,36 @@ namespace Onsharp.Native
             PluginManager.Reload();
         }
 
+        [ConsoleCommand("trace", "Records a chrome trace of ticks, bridge calls and events into the logs folder")]
+        public void OnTraceConsoleCommand([Describe("The duration of the trace in seconds, at most 60.")] int seconds = 5)
+        {
+            if (Onset.StartTrace(seconds))
+                Logger.Info("Tracing for {SECONDS} seconds...", seconds);
+            else
+                Logger.Warn("A trace is already running!");
+        }
+
+        [ConsoleCommand("stoprecording", "Stops the recording of the bridge traffic")]
+        public void OnStopRecordingConsoleCommand()
+        {
+            if (Onset.StopBridgeRecording())
+                Logger.Info("The recording of the bridge traffic is stopped.");
+            else
+                Logger.Warn("The bridge traffic is not recorded!");
+        }
+
+        [ConsoleCommand("ticks", "Shows the histogram of the last tick durations")]
+        public void OnTicksConsoleCommand()
+        {
+            int[] counts = new int[16];
+            int buckets = Onset.GetTickHistogram(counts, counts.Length);
+            for (int i = 0; i < buckets; i++)
+            {
+                string range = i == buckets - 1 ? "> " + (1 << (i - 1)) + " ms" : "<= " + (1 << i) + " ms";
+                Logger.Info("{RANGE}: {COUNT} ticks", range, counts[i]);
+            }
+        }
+
         [ConsoleCommand("exit", "Stops the server")]
         public void OnExitConsoleCommand()
         {
@@ -0,0 +1,17 @@
+﻿namespace Onsharp.Native
+{
+    /// <summary>
+    /// The entity types as the native runtime numbers them. The generic entity functions take this instead of the
+    /// entity name, so the native side can pick the matching function without building a name.
+    /// </summary>
+    internal enum EntityType
+    {
+        Player = 0,
+        Vehicle = 1,
+        NPC = 2,
+        Object = 3,
+        Pickup = 4,
+        Text3D = 5,
+        Door = 6
+    }
+}
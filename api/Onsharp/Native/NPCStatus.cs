@@ -0,0 +1,60 @@
+﻿using System.Runtime.InteropServices;
+using Onsharp.World;
+
+namespace Onsharp.Native
+{
+    /// <summary>
+    /// The commonly read values of a NPC.
+    /// The layout is shared with the native runtime, which fills it in one call.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Size = 56)]
+    public struct NPCStatus
+    {
+        /// <summary>
+        /// The x coordinate of the position.
+        /// </summary>
+        public double X { get; }
+
+        /// <summary>
+        /// The y coordinate of the position.
+        /// </summary>
+        public double Y { get; }
+
+        /// <summary>
+        /// The z coordinate of the position.
+        /// </summary>
+        public double Z { get; }
+
+        /// <summary>
+        /// The heading of the NPC.
+        /// </summary>
+        public double Heading { get; }
+
+        /// <summary>
+        /// The health of the NPC.
+        /// </summary>
+        public double Health { get; }
+
+        /// <summary>
+        /// The id of the NPC.
+        /// </summary>
+        public int Id { get; }
+
+        private readonly int _valid;
+
+        /// <summary>
+        /// The dimension the NPC is in.
+        /// </summary>
+        public uint Dimension { get; }
+
+        /// <summary>
+        /// True, if the entity was valid when the status was read. All other values are zero otherwise.
+        /// </summary>
+        public bool IsValid => _valid != 0;
+
+        /// <summary>
+        /// The position at the time the status was read.
+        /// </summary>
+        public Vector Position => new Vector(X, Y, Z);
+    }
+}
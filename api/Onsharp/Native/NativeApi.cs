@@ -0,0 +1,552 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace Onsharp.Native
+{
+    /// <summary>
+    /// The function table handed over by the native runtime when loading. The blittable exports are called through
+    /// these unmanaged function pointers instead of being resolved by name and going through the marshalling stubs.
+    /// The order of the functions has to match the NATIVE_API_FUNCTIONS list of the runtime.
+    /// </summary>
+    internal static unsafe class NativeApi
+    {
+        /// <summary>
+        /// The version of the function table this api expects. New functions are only appended, so a newer runtime
+        /// with a greater function count is still compatible.
+        /// </summary>
+        internal const int Version = 1;
+
+        /// <summary>
+        /// The version of the callback table the native runtime expects to be filled.
+        /// </summary>
+        internal const int CallbacksVersion = 2;
+
+        /// <summary>
+        /// The count of functions read from the table, which is the length of the NATIVE_API_FUNCTIONS list.
+        /// </summary>
+        private const int FunctionCount = 216;
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct Table
+        {
+            internal int Version;
+            internal int Count;
+            internal IntPtr* Functions;
+        }
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct Callbacks
+        {
+            internal int Version;
+            internal IntPtr Unload;
+            internal IntPtr Init;
+            internal IntPtr TriggerTick;
+            internal IntPtr CallBridge;
+            internal IntPtr WeaponShot;
+            internal IntPtr PlayerDamage;
+            internal IntPtr Stream;
+            internal IntPtr GameTick;
+        }
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void VoidCallback();
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate IntPtr CallBridgeCallback([MarshalAs(UnmanagedType.LPStr)] string key, IntPtr nArgsPtr, int len);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate byte WeaponShotCallback(WeaponShotEvent* args);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate byte PlayerDamageCallback(PlayerDamageEvent* args);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void StreamCallback(StreamEvent* args);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        private delegate void GameTickCallback(double delta);
+
+        // the delegates are kept in static fields, so they are not collected while the native runtime holds them
+        private static readonly VoidCallback UnloadCallback = Bridge.Unload;
+        private static readonly VoidCallback InitCallback = Bridge.InitRuntimeEntries;
+        private static readonly VoidCallback TriggerTickCallback = Bridge.TriggerTick;
+        private static readonly CallBridgeCallback CallBridgeEntry = Bridge.CallBridge;
+        private static readonly WeaponShotCallback WeaponShotEntry = Bridge.CallWeaponShot;
+        private static readonly PlayerDamageCallback PlayerDamageEntry = Bridge.CallPlayerDamage;
+        private static readonly StreamCallback StreamEntry = Bridge.CallStream;
+        private static readonly GameTickCallback GameTickEntry = Bridge.CallGameTick;
+
+        internal static delegate* unmanaged[Cdecl]<int, byte, byte> SetPlayerRagdoll;
+        internal static delegate* unmanaged[Cdecl]<int, long> GetPlayerSteamId;
+        internal static delegate* unmanaged[Cdecl]<int, float> GetPlayerHeadSize;
+        internal static delegate* unmanaged[Cdecl]<int, float, void> SetPlayerHeadSize;
+        internal static delegate* unmanaged[Cdecl]<int, byte, void> AttachPlayerParachute;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetPlayerGameVersion;
+        internal static delegate* unmanaged[Cdecl]<int, IntPtr> GetPlayerGUID;
+        internal static delegate* unmanaged[Cdecl]<int, IntPtr> GetPlayerLocale;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetPlayerPing;
+        internal static delegate* unmanaged[Cdecl]<int, IntPtr> GetPlayerIP;
+        internal static delegate* unmanaged[Cdecl]<int, long> GetPlayerRespawnTime;
+        internal static delegate* unmanaged[Cdecl]<int, long, void> SetPlayerRespawnTime;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetPlayerArmor;
+        internal static delegate* unmanaged[Cdecl]<int, double, void> SetPlayerArmor;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetPlayerHealth;
+        internal static delegate* unmanaged[Cdecl]<int, double, void> SetPlayerHealth;
+        internal static delegate* unmanaged[Cdecl]<int, byte> IsPlayerDead;
+        internal static delegate* unmanaged[Cdecl]<int, byte, void> SetPlayerSpectate;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetPlayerHeading;
+        internal static delegate* unmanaged[Cdecl]<int, double, void> SetPlayerHeading;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte> EquipPlayerWeaponSlot;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetPlayerEquippedWeaponSlot;
+        internal static delegate* unmanaged[Cdecl]<int, int, int, byte, int, byte, byte> SetPlayerWeapon;
+        internal static delegate* unmanaged[Cdecl]<int, void> RemovePlayerFromVehicle;
+        internal static delegate* unmanaged[Cdecl]<int, int, int, void> SetPlayerInVehicle;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetPlayerVehicleSeat;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetPlayerVehicle;
+        internal static delegate* unmanaged[Cdecl]<int, byte> IsPlayerReloading;
+        internal static delegate* unmanaged[Cdecl]<int, byte> IsPlayerAiming;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetPlayerMovementSpeed;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetPlayerMovementMode;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetPlayerState;
+        internal static delegate* unmanaged[Cdecl]<int, uint, byte> SetPlayerVoiceDimension;
+        internal static delegate* unmanaged[Cdecl]<int, byte> IsPlayerTalking;
+        internal static delegate* unmanaged[Cdecl]<int, byte> IsPlayerVoiceEnabled;
+        internal static delegate* unmanaged[Cdecl]<int, byte, void> SetPlayerVoiceEnabled;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte> IsPlayerVoiceChannel;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte, void> SetPlayerVoiceChannel;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, double, void> SetPlayerSpawnLocation;
+        internal static delegate* unmanaged[Cdecl]<int, byte, void> EnableVehicleBackfire;
+        internal static delegate* unmanaged[Cdecl]<int, byte, void> AttachVehicleNitro;
+        internal static delegate* unmanaged[Cdecl]<int, byte> GetVehicleLightEnabled;
+        internal static delegate* unmanaged[Cdecl]<int, byte, void> SetVehicleLightEnabled;
+        internal static delegate* unmanaged[Cdecl]<int, byte> GetVehicleEngineState;
+        internal static delegate* unmanaged[Cdecl]<int, void> StopVehicleEngine;
+        internal static delegate* unmanaged[Cdecl]<int, void> StartVehicleEngine;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetVehicleTrunkRatio;
+        internal static delegate* unmanaged[Cdecl]<int, double, void> SetVehicleTrunkRatio;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetVehicleHoodRatio;
+        internal static delegate* unmanaged[Cdecl]<int, double, void> SetVehicleHoodRatio;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetVehicleGear;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, byte, void> SetVehicleAngularVelocity;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, byte, void> SetVehicleLinearVelocity;
+        internal static delegate* unmanaged[Cdecl]<int, IntPtr> GetVehicleColor;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetVehicleNumberOfSeats;
+        internal static delegate* unmanaged[Cdecl]<int, int, int> GetVehiclePassenger;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetVehicleDriver;
+        internal static delegate* unmanaged[Cdecl]<int, double, void> SetVehicleHealth;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetVehicleHealth;
+        internal static delegate* unmanaged[Cdecl]<int, double, void> SetVehicleHeading;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetVehicleHeading;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, void> SetVehicleRotation;
+        internal static delegate* unmanaged[Cdecl]<int, byte, long, byte, byte> SetVehicleRespawnParams;
+        internal static delegate* unmanaged[Cdecl]<int, IntPtr> GetVehicleModelName;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetVehicleModel;
+        internal static delegate* unmanaged[Cdecl]<int, IntPtr> GetVehicleLicensePlate;
+        internal static delegate* unmanaged[Cdecl]<int, int, float, byte> SetVehicleDamage;
+        internal static delegate* unmanaged[Cdecl]<int, int, float> GetVehicleDamage;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, double, int> CreateVehicle;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte, void> SetText3DVisibility;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte, void> SetPickupVisibility;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, void> SetPickupScale;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, int> CreatePickup;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetObjectModel;
+        internal static delegate* unmanaged[Cdecl]<int, int, void> SetObjectModel;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, void> SetObjectRotateAxis;
+        internal static delegate* unmanaged[Cdecl]<int, void> StopObjectMove;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, double, void> SetObjectMoveTo;
+        internal static delegate* unmanaged[Cdecl]<int, byte> IsObjectMoving;
+        internal static delegate* unmanaged[Cdecl]<int, byte> IsObjectAttached;
+        internal static delegate* unmanaged[Cdecl]<int, void> SetObjectDetached;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, void> SetObjectScale;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, void> SetObjectRotation;
+        internal static delegate* unmanaged[Cdecl]<int, double, void> SetObjectStreamDistance;
+        internal static delegate* unmanaged[Cdecl]<int, int, double, void> SetNPCFollowVehicle;
+        internal static delegate* unmanaged[Cdecl]<int, int, double, void> SetNPCFollowPlayer;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, double, void> SetNPCTargetLocation;
+        internal static delegate* unmanaged[Cdecl]<int, double, void> SetNPCHeading;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetNPCHeading;
+        internal static delegate* unmanaged[Cdecl]<int, double, void> SetNPCHealth;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetNPCHealth;
+        internal static delegate* unmanaged[Cdecl]<double, double, double, double, int> CreateNPC;
+        internal static delegate* unmanaged[Cdecl]<int, byte, void> SetNPCRagdoll;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetDoorModel;
+        internal static delegate* unmanaged[Cdecl]<int, byte, void> SetDoorOpen;
+        internal static delegate* unmanaged[Cdecl]<int, byte> GetDoorOpen;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, double, byte, int> CreateDoor;
+        internal static delegate* unmanaged[Cdecl]<long> GetDroppedLogCount;
+        internal static delegate* unmanaged[Cdecl]<int, byte> StartTrace;
+        internal static delegate* unmanaged[Cdecl]<byte> IsTraceActive;
+        internal static delegate* unmanaged[Cdecl]<double, void> ConfigureTickMonitor;
+        internal static delegate* unmanaged[Cdecl]<float, int, void> ConfigureNetworkSampler;
+        internal static delegate* unmanaged[Cdecl]<int, byte> IsTimerValid;
+        internal static delegate* unmanaged[Cdecl]<int, void> DestroyTimer;
+        internal static delegate* unmanaged[Cdecl]<int, void> PauseTimer;
+        internal static delegate* unmanaged[Cdecl]<int, void> UnpauseTimer;
+        internal static delegate* unmanaged[Cdecl]<int, double> GetTimerRemainingTime;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, uint, byte, double, double, double, byte> CreateExplosion;
+        internal static delegate* unmanaged[Cdecl]<int> GetMaxPlayers;
+        internal static delegate* unmanaged[Cdecl]<IntPtr> GetServerName;
+        internal static delegate* unmanaged[Cdecl]<double> GetServerTickRate;
+        internal static delegate* unmanaged[Cdecl]<double> GetTheTickCount;
+        internal static delegate* unmanaged[Cdecl]<double> GetTimeSeconds;
+        internal static delegate* unmanaged[Cdecl]<double> GetDeltaSeconds;
+        internal static delegate* unmanaged[Cdecl]<int> GetGameVersion;
+        internal static delegate* unmanaged[Cdecl]<IntPtr> GetGameVersionAsString;
+        internal static delegate* unmanaged[Cdecl]<int, double, double, double, double, double, double, double, double, double, int> CreateObject;
+        internal static delegate* unmanaged[Cdecl]<IntPtr> GetAllPackages;
+        internal static delegate* unmanaged[Cdecl]<int, IntPtr> GetPlayerName;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, IntPtr, IntPtr, void> AddValueToTable;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, IntPtr, void> RemoveTableKey;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, IntPtr, byte> ContainsTableKey;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, IntPtr, IntPtr> GetValueFromTable;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, int> GetLengthOfTable;
+        internal static delegate* unmanaged[Cdecl]<void> ShutdownServer;
+        internal static delegate* unmanaged[Cdecl]<int, IntPtr> CreateNValue_i;
+        internal static delegate* unmanaged[Cdecl]<double, IntPtr> CreateNValue_d;
+        internal static delegate* unmanaged[Cdecl]<byte, IntPtr> CreateNValue_b;
+        internal static delegate* unmanaged[Cdecl]<IntPtr> CreateNValue_n;
+        internal static delegate* unmanaged[Cdecl]<IntPtr> CreateNValue_t;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, void> FreeNValue;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, double> GetNDouble;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, int> GetNInt;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, byte> GetNBoolean;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, IntPtr> GetNString;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, IntPtr> CreateNValue_u8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, void> SetPlayerAnimationUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, void> KickPlayerUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, void> SetPlayerNameUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, void> SendPlayerChatMessageUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, byte, void> SetNPCAnimationUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, void> SetVehicleLicensePlateUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, void> SetText3DTextUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, int, double, double, double, double, double, double, int> CreateText3DUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, IntPtr*, int, void> CallRemoteUtf8;
+        internal static delegate* unmanaged[Cdecl]<int*, int, byte*, int, IntPtr*, int, void> CallRemoteMulticastUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, IntPtr*, int, void> CallRemoteBroadcastUtf8;
+        internal static delegate* unmanaged[Cdecl]<uint, byte*, int, IntPtr*, int, void> CallRemoteDimensionUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, int> GetPlayerNameUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, int> GetPlayerIPUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, int> GetPlayerGUIDUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, int> GetPlayerLocaleUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, int> GetVehicleModelNameUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, int> GetVehicleLicensePlateUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, int> GetServerNameUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, int> GetGameVersionAsStringUtf8;
+        internal static delegate* unmanaged[Cdecl]<int*, int, PlayerStatus*, int> GetPlayerStatuses;
+        internal static delegate* unmanaged[Cdecl]<int*, int, VehicleStatus*, int> GetVehicleStatuses;
+        internal static delegate* unmanaged[Cdecl]<int*, int, NPCStatus*, int> GetNPCStatuses;
+        internal static delegate* unmanaged[Cdecl]<int, int, double*, double*, double*, void> GetEntityPosition;
+        internal static delegate* unmanaged[Cdecl]<int, int, double, double, double, void> SetEntityPosition;
+        internal static delegate* unmanaged[Cdecl]<int, int, uint> GetEntityDimension;
+        internal static delegate* unmanaged[Cdecl]<int, int, uint, void> SetEntityDimension;
+        internal static delegate* unmanaged[Cdecl]<int, int*, uint*, int, void> GetEntityDimensions;
+        internal static delegate* unmanaged[Cdecl]<uint, int, int*, int, int> GetDimensionMembers;
+        internal static delegate* unmanaged[Cdecl]<int, int, void> DestroyEntity;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte> IsEntityValid;
+        internal static delegate* unmanaged[Cdecl]<int, int, int, byte> IsStreamedIn;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetEntityCount;
+        internal static delegate* unmanaged[Cdecl]<int, int*, int, int> GetEntities;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, uint, int, int> LoadWorldLayoutUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, int*, int*, int, int> GetWorldLayoutIds;
+        internal static delegate* unmanaged[Cdecl]<int, void> ReleaseWorldLayout;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, int> OpenStoreUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte> CloseStore;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, byte*, int, void> PutStoreValue;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, void> RemoveStoreValue;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, byte*, int, int> GetStoreValue;
+        internal static delegate* unmanaged[Cdecl]<int, int> GetStoreCount;
+        internal static delegate* unmanaged[Cdecl]<int, byte> FlushStore;
+        internal static delegate* unmanaged[Cdecl]<float, void> ConfigureWorldSnapshots;
+        internal static delegate* unmanaged[Cdecl]<int, int> RestoreWorldSnapshot;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, long, IntPtr> StartBridgeRecordingUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte> StopBridgeRecording;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte, void> SetEntityPersistent;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte*, int, IntPtr> GetPropertyValueUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte*, int, IntPtr, byte, void> SetPropertyValueUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, int, int*, int*, void> GetPlayerWeapon;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte*, int, double, byte> SetPlayerWeaponStatUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, void> SetVehicleColorUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, double*, double*, double*, void> GetVehicleVelocity;
+        internal static delegate* unmanaged[Cdecl]<int, double*, double*, double*, void> GetVehicleRotation;
+        internal static delegate* unmanaged[Cdecl]<int, int, int, double, double, double, double, double, double, byte*, int, void> SetText3DAttachedUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, double*, double*, double*, void> GetPickupScale;
+        internal static delegate* unmanaged[Cdecl]<int, int*, int*, void> GetObjectAttachmentInfo;
+        internal static delegate* unmanaged[Cdecl]<int, int, int, double, double, double, double, double, double, byte*, int, void> SetObjectAttachedUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, double*, double*, double*, void> GetObjectScale;
+        internal static delegate* unmanaged[Cdecl]<int, double*, double*, double*, void> GetObjectRotation;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, double, int> CreateTimerUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, long, void> DelayUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, void> SetServerNameUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, byte> IsPackageStartedUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, void> StopPackageUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, void> StartPackageUtf8;
+        internal static delegate* unmanaged[Cdecl]<uint, double, double, double, double, int, int*, int*, int, int> QueryEntitiesInRadius;
+        internal static delegate* unmanaged[Cdecl]<uint, double, double, double, double, double, double, int, int*, int*, int, int> QueryEntitiesInBox;
+        internal static delegate* unmanaged[Cdecl]<uint, double, double, double, int, int, int*, int*, double*, int> QueryNearestEntities;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, byte*, int, int> ResolvePackageFunctionUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, IntPtr*, int, IntPtr*, int, int> InvokePackageFunction;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, byte*, int, void> ImportPackageUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, byte*, int, void> RegisterRemoteEventUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, int> RegisterCommandUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, void> RegisterCommandAliasUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, byte*, int, IntPtr*, int, byte, void> QueueRemoteUtf8;
+        internal static delegate* unmanaged[Cdecl]<byte*, int, int> RegisterLogSinkUtf8;
+        internal static delegate* unmanaged[Cdecl]<int, int, byte, byte*, int, byte> WriteLogUtf8;
+
+        /// <summary>
+        /// Reads the function pointers from the table the native runtime passed.
+        /// </summary>
+        /// <param name="tablePtr">The pointer to the native function table</param>
+        internal static void Load(IntPtr tablePtr)
+        {
+            Table* table = (Table*) tablePtr;
+            if (table->Version != Version || table->Count < FunctionCount)
+                throw new InvalidOperationException($"The native api v{table->Version} with {table->Count} functions does not match the expected v{Version}!");
+
+            IntPtr* functions = table->Functions;
+            int index = 0;
+            SetPlayerRagdoll = (delegate* unmanaged[Cdecl]<int, byte, byte>) functions[index++];
+            GetPlayerSteamId = (delegate* unmanaged[Cdecl]<int, long>) functions[index++];
+            GetPlayerHeadSize = (delegate* unmanaged[Cdecl]<int, float>) functions[index++];
+            SetPlayerHeadSize = (delegate* unmanaged[Cdecl]<int, float, void>) functions[index++];
+            AttachPlayerParachute = (delegate* unmanaged[Cdecl]<int, byte, void>) functions[index++];
+            GetPlayerGameVersion = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            GetPlayerGUID = (delegate* unmanaged[Cdecl]<int, IntPtr>) functions[index++];
+            GetPlayerLocale = (delegate* unmanaged[Cdecl]<int, IntPtr>) functions[index++];
+            GetPlayerPing = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            GetPlayerIP = (delegate* unmanaged[Cdecl]<int, IntPtr>) functions[index++];
+            GetPlayerRespawnTime = (delegate* unmanaged[Cdecl]<int, long>) functions[index++];
+            SetPlayerRespawnTime = (delegate* unmanaged[Cdecl]<int, long, void>) functions[index++];
+            GetPlayerArmor = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            SetPlayerArmor = (delegate* unmanaged[Cdecl]<int, double, void>) functions[index++];
+            GetPlayerHealth = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            SetPlayerHealth = (delegate* unmanaged[Cdecl]<int, double, void>) functions[index++];
+            IsPlayerDead = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            SetPlayerSpectate = (delegate* unmanaged[Cdecl]<int, byte, void>) functions[index++];
+            GetPlayerHeading = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            SetPlayerHeading = (delegate* unmanaged[Cdecl]<int, double, void>) functions[index++];
+            EquipPlayerWeaponSlot = (delegate* unmanaged[Cdecl]<int, int, byte>) functions[index++];
+            GetPlayerEquippedWeaponSlot = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            SetPlayerWeapon = (delegate* unmanaged[Cdecl]<int, int, int, byte, int, byte, byte>) functions[index++];
+            RemovePlayerFromVehicle = (delegate* unmanaged[Cdecl]<int, void>) functions[index++];
+            SetPlayerInVehicle = (delegate* unmanaged[Cdecl]<int, int, int, void>) functions[index++];
+            GetPlayerVehicleSeat = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            GetPlayerVehicle = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            IsPlayerReloading = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            IsPlayerAiming = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            GetPlayerMovementSpeed = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            GetPlayerMovementMode = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            GetPlayerState = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            SetPlayerVoiceDimension = (delegate* unmanaged[Cdecl]<int, uint, byte>) functions[index++];
+            IsPlayerTalking = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            IsPlayerVoiceEnabled = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            SetPlayerVoiceEnabled = (delegate* unmanaged[Cdecl]<int, byte, void>) functions[index++];
+            IsPlayerVoiceChannel = (delegate* unmanaged[Cdecl]<int, int, byte>) functions[index++];
+            SetPlayerVoiceChannel = (delegate* unmanaged[Cdecl]<int, int, byte, void>) functions[index++];
+            SetPlayerSpawnLocation = (delegate* unmanaged[Cdecl]<int, double, double, double, double, void>) functions[index++];
+            EnableVehicleBackfire = (delegate* unmanaged[Cdecl]<int, byte, void>) functions[index++];
+            AttachVehicleNitro = (delegate* unmanaged[Cdecl]<int, byte, void>) functions[index++];
+            GetVehicleLightEnabled = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            SetVehicleLightEnabled = (delegate* unmanaged[Cdecl]<int, byte, void>) functions[index++];
+            GetVehicleEngineState = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            StopVehicleEngine = (delegate* unmanaged[Cdecl]<int, void>) functions[index++];
+            StartVehicleEngine = (delegate* unmanaged[Cdecl]<int, void>) functions[index++];
+            GetVehicleTrunkRatio = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            SetVehicleTrunkRatio = (delegate* unmanaged[Cdecl]<int, double, void>) functions[index++];
+            GetVehicleHoodRatio = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            SetVehicleHoodRatio = (delegate* unmanaged[Cdecl]<int, double, void>) functions[index++];
+            GetVehicleGear = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            SetVehicleAngularVelocity = (delegate* unmanaged[Cdecl]<int, double, double, double, byte, void>) functions[index++];
+            SetVehicleLinearVelocity = (delegate* unmanaged[Cdecl]<int, double, double, double, byte, void>) functions[index++];
+            GetVehicleColor = (delegate* unmanaged[Cdecl]<int, IntPtr>) functions[index++];
+            GetVehicleNumberOfSeats = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            GetVehiclePassenger = (delegate* unmanaged[Cdecl]<int, int, int>) functions[index++];
+            GetVehicleDriver = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            SetVehicleHealth = (delegate* unmanaged[Cdecl]<int, double, void>) functions[index++];
+            GetVehicleHealth = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            SetVehicleHeading = (delegate* unmanaged[Cdecl]<int, double, void>) functions[index++];
+            GetVehicleHeading = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            SetVehicleRotation = (delegate* unmanaged[Cdecl]<int, double, double, double, void>) functions[index++];
+            SetVehicleRespawnParams = (delegate* unmanaged[Cdecl]<int, byte, long, byte, byte>) functions[index++];
+            GetVehicleModelName = (delegate* unmanaged[Cdecl]<int, IntPtr>) functions[index++];
+            GetVehicleModel = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            GetVehicleLicensePlate = (delegate* unmanaged[Cdecl]<int, IntPtr>) functions[index++];
+            SetVehicleDamage = (delegate* unmanaged[Cdecl]<int, int, float, byte>) functions[index++];
+            GetVehicleDamage = (delegate* unmanaged[Cdecl]<int, int, float>) functions[index++];
+            CreateVehicle = (delegate* unmanaged[Cdecl]<int, double, double, double, double, int>) functions[index++];
+            SetText3DVisibility = (delegate* unmanaged[Cdecl]<int, int, byte, void>) functions[index++];
+            SetPickupVisibility = (delegate* unmanaged[Cdecl]<int, int, byte, void>) functions[index++];
+            SetPickupScale = (delegate* unmanaged[Cdecl]<int, double, double, double, void>) functions[index++];
+            CreatePickup = (delegate* unmanaged[Cdecl]<int, double, double, double, int>) functions[index++];
+            GetObjectModel = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            SetObjectModel = (delegate* unmanaged[Cdecl]<int, int, void>) functions[index++];
+            SetObjectRotateAxis = (delegate* unmanaged[Cdecl]<int, double, double, double, void>) functions[index++];
+            StopObjectMove = (delegate* unmanaged[Cdecl]<int, void>) functions[index++];
+            SetObjectMoveTo = (delegate* unmanaged[Cdecl]<int, double, double, double, double, void>) functions[index++];
+            IsObjectMoving = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            IsObjectAttached = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            SetObjectDetached = (delegate* unmanaged[Cdecl]<int, void>) functions[index++];
+            SetObjectScale = (delegate* unmanaged[Cdecl]<int, double, double, double, void>) functions[index++];
+            SetObjectRotation = (delegate* unmanaged[Cdecl]<int, double, double, double, void>) functions[index++];
+            SetObjectStreamDistance = (delegate* unmanaged[Cdecl]<int, double, void>) functions[index++];
+            SetNPCFollowVehicle = (delegate* unmanaged[Cdecl]<int, int, double, void>) functions[index++];
+            SetNPCFollowPlayer = (delegate* unmanaged[Cdecl]<int, int, double, void>) functions[index++];
+            SetNPCTargetLocation = (delegate* unmanaged[Cdecl]<int, double, double, double, double, void>) functions[index++];
+            SetNPCHeading = (delegate* unmanaged[Cdecl]<int, double, void>) functions[index++];
+            GetNPCHeading = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            SetNPCHealth = (delegate* unmanaged[Cdecl]<int, double, void>) functions[index++];
+            GetNPCHealth = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            CreateNPC = (delegate* unmanaged[Cdecl]<double, double, double, double, int>) functions[index++];
+            SetNPCRagdoll = (delegate* unmanaged[Cdecl]<int, byte, void>) functions[index++];
+            GetDoorModel = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            SetDoorOpen = (delegate* unmanaged[Cdecl]<int, byte, void>) functions[index++];
+            GetDoorOpen = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            CreateDoor = (delegate* unmanaged[Cdecl]<int, double, double, double, double, byte, int>) functions[index++];
+            GetDroppedLogCount = (delegate* unmanaged[Cdecl]<long>) functions[index++];
+            StartTrace = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            IsTraceActive = (delegate* unmanaged[Cdecl]<byte>) functions[index++];
+            ConfigureTickMonitor = (delegate* unmanaged[Cdecl]<double, void>) functions[index++];
+            ConfigureNetworkSampler = (delegate* unmanaged[Cdecl]<float, int, void>) functions[index++];
+            IsTimerValid = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            DestroyTimer = (delegate* unmanaged[Cdecl]<int, void>) functions[index++];
+            PauseTimer = (delegate* unmanaged[Cdecl]<int, void>) functions[index++];
+            UnpauseTimer = (delegate* unmanaged[Cdecl]<int, void>) functions[index++];
+            GetTimerRemainingTime = (delegate* unmanaged[Cdecl]<int, double>) functions[index++];
+            CreateExplosion = (delegate* unmanaged[Cdecl]<int, double, double, double, uint, byte, double, double, double, byte>) functions[index++];
+            GetMaxPlayers = (delegate* unmanaged[Cdecl]<int>) functions[index++];
+            GetServerName = (delegate* unmanaged[Cdecl]<IntPtr>) functions[index++];
+            GetServerTickRate = (delegate* unmanaged[Cdecl]<double>) functions[index++];
+            GetTheTickCount = (delegate* unmanaged[Cdecl]<double>) functions[index++];
+            GetTimeSeconds = (delegate* unmanaged[Cdecl]<double>) functions[index++];
+            GetDeltaSeconds = (delegate* unmanaged[Cdecl]<double>) functions[index++];
+            GetGameVersion = (delegate* unmanaged[Cdecl]<int>) functions[index++];
+            GetGameVersionAsString = (delegate* unmanaged[Cdecl]<IntPtr>) functions[index++];
+            CreateObject = (delegate* unmanaged[Cdecl]<int, double, double, double, double, double, double, double, double, double, int>) functions[index++];
+            GetAllPackages = (delegate* unmanaged[Cdecl]<IntPtr>) functions[index++];
+            GetPlayerName = (delegate* unmanaged[Cdecl]<int, IntPtr>) functions[index++];
+            AddValueToTable = (delegate* unmanaged[Cdecl]<IntPtr, IntPtr, IntPtr, void>) functions[index++];
+            RemoveTableKey = (delegate* unmanaged[Cdecl]<IntPtr, IntPtr, void>) functions[index++];
+            ContainsTableKey = (delegate* unmanaged[Cdecl]<IntPtr, IntPtr, byte>) functions[index++];
+            GetValueFromTable = (delegate* unmanaged[Cdecl]<IntPtr, IntPtr, IntPtr>) functions[index++];
+            GetLengthOfTable = (delegate* unmanaged[Cdecl]<IntPtr, int>) functions[index++];
+            ShutdownServer = (delegate* unmanaged[Cdecl]<void>) functions[index++];
+            CreateNValue_i = (delegate* unmanaged[Cdecl]<int, IntPtr>) functions[index++];
+            CreateNValue_d = (delegate* unmanaged[Cdecl]<double, IntPtr>) functions[index++];
+            CreateNValue_b = (delegate* unmanaged[Cdecl]<byte, IntPtr>) functions[index++];
+            CreateNValue_n = (delegate* unmanaged[Cdecl]<IntPtr>) functions[index++];
+            CreateNValue_t = (delegate* unmanaged[Cdecl]<IntPtr>) functions[index++];
+            FreeNValue = (delegate* unmanaged[Cdecl]<IntPtr, void>) functions[index++];
+            GetNDouble = (delegate* unmanaged[Cdecl]<IntPtr, double>) functions[index++];
+            GetNInt = (delegate* unmanaged[Cdecl]<IntPtr, int>) functions[index++];
+            GetNBoolean = (delegate* unmanaged[Cdecl]<IntPtr, byte>) functions[index++];
+            GetNString = (delegate* unmanaged[Cdecl]<IntPtr, IntPtr>) functions[index++];
+            CreateNValue_u8 = (delegate* unmanaged[Cdecl]<byte*, int, IntPtr>) functions[index++];
+            SetPlayerAnimationUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, void>) functions[index++];
+            KickPlayerUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, void>) functions[index++];
+            SetPlayerNameUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, void>) functions[index++];
+            SendPlayerChatMessageUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, void>) functions[index++];
+            SetNPCAnimationUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, byte, void>) functions[index++];
+            SetVehicleLicensePlateUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, void>) functions[index++];
+            SetText3DTextUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, void>) functions[index++];
+            CreateText3DUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, int, double, double, double, double, double, double, int>) functions[index++];
+            CallRemoteUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, IntPtr*, int, void>) functions[index++];
+            CallRemoteMulticastUtf8 = (delegate* unmanaged[Cdecl]<int*, int, byte*, int, IntPtr*, int, void>) functions[index++];
+            CallRemoteBroadcastUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, IntPtr*, int, void>) functions[index++];
+            CallRemoteDimensionUtf8 = (delegate* unmanaged[Cdecl]<uint, byte*, int, IntPtr*, int, void>) functions[index++];
+            GetPlayerNameUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, int>) functions[index++];
+            GetPlayerIPUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, int>) functions[index++];
+            GetPlayerGUIDUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, int>) functions[index++];
+            GetPlayerLocaleUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, int>) functions[index++];
+            GetVehicleModelNameUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, int>) functions[index++];
+            GetVehicleLicensePlateUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, int>) functions[index++];
+            GetServerNameUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, int>) functions[index++];
+            GetGameVersionAsStringUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, int>) functions[index++];
+            GetPlayerStatuses = (delegate* unmanaged[Cdecl]<int*, int, PlayerStatus*, int>) functions[index++];
+            GetVehicleStatuses = (delegate* unmanaged[Cdecl]<int*, int, VehicleStatus*, int>) functions[index++];
+            GetNPCStatuses = (delegate* unmanaged[Cdecl]<int*, int, NPCStatus*, int>) functions[index++];
+            GetEntityPosition = (delegate* unmanaged[Cdecl]<int, int, double*, double*, double*, void>) functions[index++];
+            SetEntityPosition = (delegate* unmanaged[Cdecl]<int, int, double, double, double, void>) functions[index++];
+            GetEntityDimension = (delegate* unmanaged[Cdecl]<int, int, uint>) functions[index++];
+            SetEntityDimension = (delegate* unmanaged[Cdecl]<int, int, uint, void>) functions[index++];
+            GetEntityDimensions = (delegate* unmanaged[Cdecl]<int, int*, uint*, int, void>) functions[index++];
+            GetDimensionMembers = (delegate* unmanaged[Cdecl]<uint, int, int*, int, int>) functions[index++];
+            DestroyEntity = (delegate* unmanaged[Cdecl]<int, int, void>) functions[index++];
+            IsEntityValid = (delegate* unmanaged[Cdecl]<int, int, byte>) functions[index++];
+            IsStreamedIn = (delegate* unmanaged[Cdecl]<int, int, int, byte>) functions[index++];
+            GetEntityCount = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            GetEntities = (delegate* unmanaged[Cdecl]<int, int*, int, int>) functions[index++];
+            LoadWorldLayoutUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, uint, int, int>) functions[index++];
+            GetWorldLayoutIds = (delegate* unmanaged[Cdecl]<int, int*, int*, int, int>) functions[index++];
+            ReleaseWorldLayout = (delegate* unmanaged[Cdecl]<int, void>) functions[index++];
+            OpenStoreUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, int>) functions[index++];
+            CloseStore = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            PutStoreValue = (delegate* unmanaged[Cdecl]<int, byte*, int, byte*, int, void>) functions[index++];
+            RemoveStoreValue = (delegate* unmanaged[Cdecl]<int, byte*, int, void>) functions[index++];
+            GetStoreValue = (delegate* unmanaged[Cdecl]<int, byte*, int, byte*, int, int>) functions[index++];
+            GetStoreCount = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            FlushStore = (delegate* unmanaged[Cdecl]<int, byte>) functions[index++];
+            ConfigureWorldSnapshots = (delegate* unmanaged[Cdecl]<float, void>) functions[index++];
+            RestoreWorldSnapshot = (delegate* unmanaged[Cdecl]<int, int>) functions[index++];
+            StartBridgeRecordingUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, long, IntPtr>) functions[index++];
+            StopBridgeRecording = (delegate* unmanaged[Cdecl]<byte>) functions[index++];
+            SetEntityPersistent = (delegate* unmanaged[Cdecl]<int, int, byte, void>) functions[index++];
+            GetPropertyValueUtf8 = (delegate* unmanaged[Cdecl]<int, int, byte*, int, IntPtr>) functions[index++];
+            SetPropertyValueUtf8 = (delegate* unmanaged[Cdecl]<int, int, byte*, int, IntPtr, byte, void>) functions[index++];
+            GetPlayerWeapon = (delegate* unmanaged[Cdecl]<int, int, int*, int*, void>) functions[index++];
+            SetPlayerWeaponStatUtf8 = (delegate* unmanaged[Cdecl]<int, int, byte*, int, double, byte>) functions[index++];
+            SetVehicleColorUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, void>) functions[index++];
+            GetVehicleVelocity = (delegate* unmanaged[Cdecl]<int, double*, double*, double*, void>) functions[index++];
+            GetVehicleRotation = (delegate* unmanaged[Cdecl]<int, double*, double*, double*, void>) functions[index++];
+            SetText3DAttachedUtf8 = (delegate* unmanaged[Cdecl]<int, int, int, double, double, double, double, double, double, byte*, int, void>) functions[index++];
+            GetPickupScale = (delegate* unmanaged[Cdecl]<int, double*, double*, double*, void>) functions[index++];
+            GetObjectAttachmentInfo = (delegate* unmanaged[Cdecl]<int, int*, int*, void>) functions[index++];
+            SetObjectAttachedUtf8 = (delegate* unmanaged[Cdecl]<int, int, int, double, double, double, double, double, double, byte*, int, void>) functions[index++];
+            GetObjectScale = (delegate* unmanaged[Cdecl]<int, double*, double*, double*, void>) functions[index++];
+            GetObjectRotation = (delegate* unmanaged[Cdecl]<int, double*, double*, double*, void>) functions[index++];
+            CreateTimerUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, double, int>) functions[index++];
+            DelayUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, long, void>) functions[index++];
+            SetServerNameUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, void>) functions[index++];
+            IsPackageStartedUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, byte>) functions[index++];
+            StopPackageUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, void>) functions[index++];
+            StartPackageUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, void>) functions[index++];
+            QueryEntitiesInRadius = (delegate* unmanaged[Cdecl]<uint, double, double, double, double, int, int*, int*, int, int>) functions[index++];
+            QueryEntitiesInBox = (delegate* unmanaged[Cdecl]<uint, double, double, double, double, double, double, int, int*, int*, int, int>) functions[index++];
+            QueryNearestEntities = (delegate* unmanaged[Cdecl]<uint, double, double, double, int, int, int*, int*, double*, int>) functions[index++];
+            ResolvePackageFunctionUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, byte*, int, int>) functions[index++];
+            InvokePackageFunction = (delegate* unmanaged[Cdecl]<int, IntPtr*, int, IntPtr*, int, int>) functions[index++];
+            ImportPackageUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, byte*, int, void>) functions[index++];
+            RegisterRemoteEventUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, byte*, int, void>) functions[index++];
+            RegisterCommandUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, int>) functions[index++];
+            RegisterCommandAliasUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, void>) functions[index++];
+            QueueRemoteUtf8 = (delegate* unmanaged[Cdecl]<int, byte*, int, IntPtr*, int, byte, void>) functions[index++];
+            RegisterLogSinkUtf8 = (delegate* unmanaged[Cdecl]<byte*, int, int>) functions[index++];
+            WriteLogUtf8 = (delegate* unmanaged[Cdecl]<int, int, byte, byte*, int, byte>) functions[index++];
+        }
+
+        /// <summary>
+        /// Writes the pointers of the managed entry points into the callback table of the native runtime.
+        /// </summary>
+        /// <param name="callbacksPtr">The pointer to the native callback table</param>
+        internal static void ExportCallbacks(IntPtr callbacksPtr)
+        {
+            Callbacks* callbacks = (Callbacks*) callbacksPtr;
+            callbacks->Unload = Marshal.GetFunctionPointerForDelegate(UnloadCallback);
+            callbacks->Init = Marshal.GetFunctionPointerForDelegate(InitCallback);
+            callbacks->TriggerTick = Marshal.GetFunctionPointerForDelegate(TriggerTickCallback);
+            callbacks->CallBridge = Marshal.GetFunctionPointerForDelegate(CallBridgeEntry);
+            callbacks->WeaponShot = Marshal.GetFunctionPointerForDelegate(WeaponShotEntry);
+            callbacks->PlayerDamage = Marshal.GetFunctionPointerForDelegate(PlayerDamageEntry);
+            callbacks->Stream = Marshal.GetFunctionPointerForDelegate(StreamEntry);
+            callbacks->GameTick = Marshal.GetFunctionPointerForDelegate(GameTickEntry);
+            callbacks->Version = CallbacksVersion;
+        }
+
+        /// <summary>
+        /// Converts the given bool into the one byte bool of the native runtime.
+        /// </summary>
+        internal static byte FromBool(bool value)
+        {
+            return value ? (byte) 1 : (byte) 0;
+        }
+    }
+}
@@ -0,0 +1,43 @@
+﻿using System.Runtime.InteropServices;
+
+namespace Onsharp.Native
+{
+    /// <summary>
+    /// The arguments of a weapon shot, passed by the native runtime without going through the generic bridge call.
+    /// The layout is shared with the WeaponShotEvent of the native runtime.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Size = 88)]
+    internal struct WeaponShotEvent
+    {
+        internal int Player;
+        internal int Weapon;
+        internal int HitType;
+        internal int HitId;
+        internal double HitX, HitY, HitZ;
+        internal double StartX, StartY, StartZ;
+        internal double NormalX, NormalY, NormalZ;
+    }
+
+    /// <summary>
+    /// The arguments of a damaged player. The layout is shared with the PlayerDamageEvent of the native runtime.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Size = 16)]
+    internal struct PlayerDamageEvent
+    {
+        internal int Player;
+        internal int DamageType;
+        internal double Amount;
+    }
+
+    /// <summary>
+    /// The arguments of a player or NPC streamed in or out for a player. The type is the one of the event.
+    /// The layout is shared with the StreamEvent of the native runtime.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Size = 12)]
+    internal struct StreamEvent
+    {
+        internal int Type;
+        internal int Player;
+        internal int Entity;
+    }
+}
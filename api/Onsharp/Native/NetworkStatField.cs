@@ -0,0 +1,12 @@
+﻿namespace Onsharp.Native
+{
+    /// <summary>
+    /// All values of the <see cref="NetworkStats"/> which are sampled by the native runtime.
+    /// The flags are sampled as 1 for true and 0 for false.
+    /// </summary>
+    public enum NetworkStatField
+    {
+        TotalPacketLoss, LastSecondPacketLoss, MessagesInResendBuffer, BytesInResendBuffer, BytesSend, BytesReceived,
+        BytesResend, TotalBytesSend, TotalBytesReceived, IsLimitedByCongestionControl, IsLimitedByOutgoingBandwidthLimit
+    }
+}
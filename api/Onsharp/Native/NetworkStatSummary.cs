@@ -0,0 +1,33 @@
+﻿namespace Onsharp.Native
+{
+    /// <summary>
+    /// The aggregated values of one <see cref="NetworkStatField"/> over the latest samples of the native sampler.
+    /// </summary>
+    public struct NetworkStatSummary
+    {
+        /// <summary>
+        /// The count of samples the summary was built from. If zero, no samples were available yet.
+        /// </summary>
+        public int Samples { get; }
+
+        public double Min { get; }
+
+        public double Max { get; }
+
+        public double Average { get; }
+
+        /// <summary>
+        /// The value which 95 percent of the samples do not exceed.
+        /// </summary>
+        public double P95 { get; }
+
+        internal NetworkStatSummary(int samples, double min, double max, double average, double p95)
+        {
+            Samples = samples;
+            Min = min;
+            Max = max;
+            Average = average;
+            P95 = p95;
+        }
+    }
+}
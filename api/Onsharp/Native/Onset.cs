@@ -8,374 +8,363 @@ namespace Onsharp.Native
     /// This is a collection of all native methods which will call them in the c++ runtime.
     /// </summary>
     [SuppressUnmanagedCodeSecurity]
-    internal static class Onset
+    internal static unsafe class Onset
     {
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetPropertyValue([MarshalAs(UnmanagedType.LPStr)] string entityName, int entity,
-            [MarshalAs(UnmanagedType.LPStr)] string propertyName);
+        internal static IntPtr GetPropertyValue(EntityType type, int entity, string propertyName)
+        {
+            fixed (byte* ptr = Utf8.Encode(propertyName, out int length))
+            {
+                return NativeApi.GetPropertyValueUtf8((int) type, entity, ptr, length);
+            }
+        }
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPropertyValue([MarshalAs(UnmanagedType.LPStr)] string entityName, int entity,
-            [MarshalAs(UnmanagedType.LPStr)] string propertyName, IntPtr propertyValue, bool sync);
+        internal static void SetPropertyValue(EntityType type, int entity, string propertyName, IntPtr propertyValue, bool sync)
+        {
+            fixed (byte* ptr = Utf8.Encode(propertyName, out int length))
+            {
+                NativeApi.SetPropertyValueUtf8((int) type, entity, ptr, length, propertyValue, NativeApi.FromBool(sync));
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool SetPlayerRagdoll(int player, bool enable);
+        internal static bool SetPlayerRagdoll(int player, bool enable) => NativeApi.SetPlayerRagdoll(player, NativeApi.FromBool(enable)) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern long GetPlayerSteamId(int player);
+        internal static long GetPlayerSteamId(int player) => NativeApi.GetPlayerSteamId(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern float GetPlayerHeadSize(int player);
+        internal static float GetPlayerHeadSize(int player) => NativeApi.GetPlayerHeadSize(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerHeadSize(int player, float size);
+        internal static void SetPlayerHeadSize(int player, float size) => NativeApi.SetPlayerHeadSize(player, size);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void AttachPlayerParachute(int player, bool attach);
+        internal static void AttachPlayerParachute(int player, bool attach) => NativeApi.AttachPlayerParachute(player, NativeApi.FromBool(attach));
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerAnimation(int player, [MarshalAs(UnmanagedType.LPStr)] string animation);
+        internal static void SetPlayerAnimation(int player, string animation)
+        {
+            fixed (byte* ptr = Utf8.Encode(animation, out int length))
+            {
+                NativeApi.SetPlayerAnimationUtf8(player, ptr, length);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetPlayerGameVersion(int player);
+        internal static int GetPlayerGameVersion(int player) => NativeApi.GetPlayerGameVersion(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetPlayerGUID(int player);
+        internal static string GetPlayerGUID(int player) => Utf8.Read(NativeApi.GetPlayerGUIDUtf8, player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetPlayerLocale(int player);
+        internal static string GetPlayerLocale(int player) => Utf8.Read(NativeApi.GetPlayerLocaleUtf8, player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void KickPlayer(int player, [MarshalAs(UnmanagedType.LPStr)] string reason);
+        internal static void KickPlayer(int player, string reason)
+        {
+            fixed (byte* ptr = Utf8.Encode(reason, out int length))
+            {
+                NativeApi.KickPlayerUtf8(player, ptr, length);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetPlayerPing(int player);
+        internal static int GetPlayerPing(int player) => NativeApi.GetPlayerPing(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetPlayerIP(int player);
+        internal static string GetPlayerIP(int player) => Utf8.Read(NativeApi.GetPlayerIPUtf8, player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern long GetPlayerRespawnTime(int player);
+        internal static long GetPlayerRespawnTime(int player) => NativeApi.GetPlayerRespawnTime(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerRespawnTime(int player, long ms);
+        internal static void SetPlayerRespawnTime(int player, long ms) => NativeApi.SetPlayerRespawnTime(player, ms);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetPlayerArmor(int player);
+        internal static double GetPlayerArmor(int player) => NativeApi.GetPlayerArmor(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerArmor(int player, double armor);
+        internal static void SetPlayerArmor(int player, double armor) => NativeApi.SetPlayerArmor(player, armor);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetPlayerHealth(int player);
+        internal static double GetPlayerHealth(int player) => NativeApi.GetPlayerHealth(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerHealth(int player, double health);
+        internal static void SetPlayerHealth(int player, double health) => NativeApi.SetPlayerHealth(player, health);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsPlayerDead(int player);
+        internal static bool IsPlayerDead(int player) => NativeApi.IsPlayerDead(player) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerSpectate(int player, bool spectate);
+        internal static void SetPlayerSpectate(int player, bool spectate) => NativeApi.SetPlayerSpectate(player, NativeApi.FromBool(spectate));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetPlayerHeading(int player);
+        internal static double GetPlayerHeading(int player) => NativeApi.GetPlayerHeading(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerHeading(int player, double heading);
+        internal static void SetPlayerHeading(int player, double heading) => NativeApi.SetPlayerHeading(player, heading);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool EquipPlayerWeaponSlot(int player, int slot);
+        internal static bool EquipPlayerWeaponSlot(int player, int slot) => NativeApi.EquipPlayerWeaponSlot(player, slot) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetPlayerEquippedWeaponSlot(int player);
+        internal static int GetPlayerEquippedWeaponSlot(int player) => NativeApi.GetPlayerEquippedWeaponSlot(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void GetPlayerWeapon(int player, int slot, ref int model, ref int ammo);
+        internal static void GetPlayerWeapon(int player, int slot, ref int model, ref int ammo)
+        {
+            fixed (int* modelPtr = &model, ammoPtr = &ammo)
+            {
+                NativeApi.GetPlayerWeapon(player, slot, modelPtr, ammoPtr);
+            }
+        }
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool SetPlayerWeapon(int player, int weapon, int ammo, bool equip, int slot, bool loaded);
+        internal static bool SetPlayerWeapon(int player, int weapon, int ammo, bool equip, int slot, bool loaded) => NativeApi.SetPlayerWeapon(player, weapon, ammo, NativeApi.FromBool(equip), slot, NativeApi.FromBool(loaded)) != 0;
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool SetPlayerWeaponStat(int player, int weapon,
-            [MarshalAs(UnmanagedType.LPStr)] string stat, double value);
+        internal static bool SetPlayerWeaponStat(int player, int weapon, string stat, double value)
+        {
+            fixed (byte* ptr = Utf8.Encode(stat, out int length))
+            {
+                return NativeApi.SetPlayerWeaponStatUtf8(player, weapon, ptr, length, value) != 0;
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void RemovePlayerFromVehicle(int player);
+        internal static void RemovePlayerFromVehicle(int player) => NativeApi.RemovePlayerFromVehicle(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerInVehicle(int player, int vehicle, int seat);
+        internal static void SetPlayerInVehicle(int player, int vehicle, int seat) => NativeApi.SetPlayerInVehicle(player, vehicle, seat);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetPlayerVehicleSeat(int player);
+        internal static int GetPlayerVehicleSeat(int player) => NativeApi.GetPlayerVehicleSeat(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetPlayerVehicle(int player);
+        internal static int GetPlayerVehicle(int player) => NativeApi.GetPlayerVehicle(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsPlayerReloading(int player);
+        internal static bool IsPlayerReloading(int player) => NativeApi.IsPlayerReloading(player) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsPlayerAiming(int player);
+        internal static bool IsPlayerAiming(int player) => NativeApi.IsPlayerAiming(player) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetPlayerMovementSpeed(int player);
+        internal static double GetPlayerMovementSpeed(int player) => NativeApi.GetPlayerMovementSpeed(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetPlayerMovementMode(int player);
+        internal static int GetPlayerMovementMode(int player) => NativeApi.GetPlayerMovementMode(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetPlayerState(int player);
+        internal static int GetPlayerState(int player) => NativeApi.GetPlayerState(player);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool SetPlayerVoiceDimension(int player, uint dim);
+        internal static bool SetPlayerVoiceDimension(int player, uint dim) => NativeApi.SetPlayerVoiceDimension(player, dim) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsPlayerTalking(int player);
+        internal static bool IsPlayerTalking(int player) => NativeApi.IsPlayerTalking(player) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsPlayerVoiceEnabled(int player);
+        internal static bool IsPlayerVoiceEnabled(int player) => NativeApi.IsPlayerVoiceEnabled(player) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerVoiceEnabled(int player, bool enable);
+        internal static void SetPlayerVoiceEnabled(int player, bool enable) => NativeApi.SetPlayerVoiceEnabled(player, NativeApi.FromBool(enable));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsPlayerVoiceChannel(int player, int channel);
+        internal static bool IsPlayerVoiceChannel(int player, int channel) => NativeApi.IsPlayerVoiceChannel(player, channel) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerVoiceChannel(int player, int channel, bool enable);
+        internal static void SetPlayerVoiceChannel(int player, int channel, bool enable) => NativeApi.SetPlayerVoiceChannel(player, channel, NativeApi.FromBool(enable));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerSpawnLocation(int player, double x, double y, double z, double heading);
+        internal static void SetPlayerSpawnLocation(int player, double x, double y, double z, double heading) => NativeApi.SetPlayerSpawnLocation(player, x, y, z, heading);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void EnableVehicleBackfire(int vehicle, bool enable);
+        internal static void EnableVehicleBackfire(int vehicle, bool enable) => NativeApi.EnableVehicleBackfire(vehicle, NativeApi.FromBool(enable));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void AttachVehicleNitro(int vehicle, bool attach);
+        internal static void AttachVehicleNitro(int vehicle, bool attach) => NativeApi.AttachVehicleNitro(vehicle, NativeApi.FromBool(attach));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool GetVehicleLightEnabled(int vehicle);
+        internal static bool GetVehicleLightEnabled(int vehicle) => NativeApi.GetVehicleLightEnabled(vehicle) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetVehicleLightEnabled(int vehicle, bool enabled);
+        internal static void SetVehicleLightEnabled(int vehicle, bool enabled) => NativeApi.SetVehicleLightEnabled(vehicle, NativeApi.FromBool(enabled));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool GetVehicleEngineState(int vehicle);
+        internal static bool GetVehicleEngineState(int vehicle) => NativeApi.GetVehicleEngineState(vehicle) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void StopVehicleEngine(int vehicle);
+        internal static void StopVehicleEngine(int vehicle) => NativeApi.StopVehicleEngine(vehicle);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void StartVehicleEngine(int vehicle);
+        internal static void StartVehicleEngine(int vehicle) => NativeApi.StartVehicleEngine(vehicle);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetVehicleTrunkRatio(int vehicle);
+        internal static double GetVehicleTrunkRatio(int vehicle) => NativeApi.GetVehicleTrunkRatio(vehicle);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetVehicleTrunkRatio(int vehicle, double ratio);
+        internal static void SetVehicleTrunkRatio(int vehicle, double ratio) => NativeApi.SetVehicleTrunkRatio(vehicle, ratio);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetVehicleHoodRatio(int vehicle);
+        internal static double GetVehicleHoodRatio(int vehicle) => NativeApi.GetVehicleHoodRatio(vehicle);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetVehicleHoodRatio(int vehicle, double ratio);
+        internal static void SetVehicleHoodRatio(int vehicle, double ratio) => NativeApi.SetVehicleHoodRatio(vehicle, ratio);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetVehicleGear(int vehicle);
+        internal static int GetVehicleGear(int vehicle) => NativeApi.GetVehicleGear(vehicle);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetVehicleAngularVelocity(int vehicle, double x, double y, double z);
+        internal static void SetVehicleAngularVelocity(int vehicle, double x, double y, double z) => NativeApi.SetVehicleAngularVelocity(vehicle, x, y, z, 0);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetVehicleLinearVelocity(int vehicle, double x, double y, double z);
+        internal static void SetVehicleLinearVelocity(int vehicle, double x, double y, double z) => NativeApi.SetVehicleLinearVelocity(vehicle, x, y, z, 0);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetVehicleColor(int vehicle, [MarshalAs(UnmanagedType.LPStr)] string hexColor);
+        internal static void SetVehicleColor(int vehicle, string hexColor)
+        {
+            fixed (byte* ptr = Utf8.Encode(hexColor, out int length))
+            {
+                NativeApi.SetVehicleColorUtf8(vehicle, ptr, length);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetVehicleColor(int vehicle);
+        internal static IntPtr GetVehicleColor(int vehicle) => NativeApi.GetVehicleColor(vehicle);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetVehicleNumberOfSeats(int vehicle);
+        internal static int GetVehicleNumberOfSeats(int vehicle) => NativeApi.GetVehicleNumberOfSeats(vehicle);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetVehiclePassenger(int vehicle, int seat);
+        internal static int GetVehiclePassenger(int vehicle, int seat) => NativeApi.GetVehiclePassenger(vehicle, seat);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetVehicleDriver(int vehicle);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void GetVehicleVelocity(int vehicle, ref double x, ref double y, ref double z);
+        internal static int GetVehicleDriver(int vehicle) => NativeApi.GetVehicleDriver(vehicle);
+        
+        internal static void GetVehicleVelocity(int vehicle, ref double x, ref double y, ref double z)
+        {
+            fixed (double* xPtr = &x, yPtr = &y, zPtr = &z)
+            {
+                NativeApi.GetVehicleVelocity(vehicle, xPtr, yPtr, zPtr);
+            }
+        }
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetVehicleHealth(int vehicle, double health);
+        internal static void SetVehicleHealth(int vehicle, double health) => NativeApi.SetVehicleHealth(vehicle, health);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetVehicleHealth(int vehicle);
+        internal static double GetVehicleHealth(int vehicle) => NativeApi.GetVehicleHealth(vehicle);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetVehicleHeading(int vehicle, double heading);
+        internal static void SetVehicleHeading(int vehicle, double heading) => NativeApi.SetVehicleHeading(vehicle, heading);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetVehicleHeading(int vehicle);
+        internal static double GetVehicleHeading(int vehicle) => NativeApi.GetVehicleHeading(vehicle);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void GetVehicleRotation(int vehicle, ref double x, ref double y, ref double z);
+        internal static void GetVehicleRotation(int vehicle, ref double x, ref double y, ref double z)
+        {
+            fixed (double* xPtr = &x, yPtr = &y, zPtr = &z)
+            {
+                NativeApi.GetVehicleRotation(vehicle, xPtr, yPtr, zPtr);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetVehicleRotation(int vehicle, double x, double y, double z);
+        internal static void SetVehicleRotation(int vehicle, double x, double y, double z) => NativeApi.SetVehicleRotation(vehicle, x, y, z);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool SetVehicleRespawnParams(int vehicle, bool enableRespawn, long respawnTime, bool repairOnRespawn);
+        internal static bool SetVehicleRespawnParams(int vehicle, bool enableRespawn, long respawnTime, bool repairOnRespawn) => NativeApi.SetVehicleRespawnParams(vehicle, NativeApi.FromBool(enableRespawn), respawnTime, NativeApi.FromBool(repairOnRespawn)) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetVehicleModelName(int vehicle);
+        internal static string GetVehicleModelName(int vehicle) => Utf8.Read(NativeApi.GetVehicleModelNameUtf8, vehicle);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetVehicleModel(int vehicle);
+        internal static int GetVehicleModel(int vehicle) => NativeApi.GetVehicleModel(vehicle);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetVehicleLicensePlate(int vehicle, [MarshalAs(UnmanagedType.LPStr)] string text);
+        internal static void SetVehicleLicensePlate(int vehicle, string text)
+        {
+            fixed (byte* ptr = Utf8.Encode(text, out int length))
+            {
+                NativeApi.SetVehicleLicensePlateUtf8(vehicle, ptr, length);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetVehicleLicensePlate(int vehicle);
+        internal static string GetVehicleLicensePlate(int vehicle) => Utf8.Read(NativeApi.GetVehicleLicensePlateUtf8, vehicle);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool SetVehicleDamage(int vehicle, int index, float damage);
+        internal static bool SetVehicleDamage(int vehicle, int index, float damage) => NativeApi.SetVehicleDamage(vehicle, index, damage) != 0;
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern float GetVehicleDamage(int vehicle, int index);
+        internal static float GetVehicleDamage(int vehicle, int index) => NativeApi.GetVehicleDamage(vehicle, index);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int CreateVehicle(int model, double x, double y, double z, double heading);
+        internal static int CreateVehicle(int model, double x, double y, double z, double heading) => NativeApi.CreateVehicle(model, x, y, z, heading);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int CreateText3D([MarshalAs(UnmanagedType.LPStr)] string text, int size, double x,
-            double y, double z, double rx, double ry, double rz);
+        internal static int CreateText3D(string text, int size, double x, double y, double z, double rx, double ry, double rz)
+        {
+            fixed (byte* ptr = Utf8.Encode(text, out int length))
+            {
+                return NativeApi.CreateText3DUtf8(ptr, length, size, x, y, z, rx, ry, rz);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetText3DAttached(int text3d, int attachType, int entity, double x, double y, double z,
-            double rx, double ry, double rz, [MarshalAs(UnmanagedType.LPStr)] string socketName);
+        internal static void SetText3DAttached(int text3d, int attachType, int entity, double x, double y, double z,
+            double rx, double ry, double rz, string socketName)
+        {
+            fixed (byte* ptr = Utf8.Encode(socketName, out int length))
+            {
+                NativeApi.SetText3DAttachedUtf8(text3d, attachType, entity, x, y, z, rx, ry, rz, ptr, length);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetText3DVisibility(int text3d, int player, bool visible);
+        internal static void SetText3DVisibility(int text3d, int player, bool visible) => NativeApi.SetText3DVisibility(text3d, player, NativeApi.FromBool(visible));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetText3DText(int text3d, [MarshalAs(UnmanagedType.LPStr)] string text);
+        internal static void SetText3DText(int text3d, string text)
+        {
+            fixed (byte* ptr = Utf8.Encode(text, out int length))
+            {
+                NativeApi.SetText3DTextUtf8(text3d, ptr, length);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPickupVisibility(int pickup, int player, bool visible);
+        internal static void SetPickupVisibility(int pickup, int player, bool visible) => NativeApi.SetPickupVisibility(pickup, player, NativeApi.FromBool(visible));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void GetPickupScale(int pickup, ref double x, ref double y, ref double z);
+        internal static void GetPickupScale(int pickup, ref double x, ref double y, ref double z)
+        {
+            fixed (double* xPtr = &x, yPtr = &y, zPtr = &z)
+            {
+                NativeApi.GetPickupScale(pickup, xPtr, yPtr, zPtr);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPickupScale(int pickup, double x, double y, double z);
+        internal static void SetPickupScale(int pickup, double x, double y, double z) => NativeApi.SetPickupScale(pickup, x, y, z);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int CreatePickup(int model, double x, double y, double z);
+        internal static int CreatePickup(int model, double x, double y, double z) => NativeApi.CreatePickup(model, x, y, z);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetObjectModel(int obj);
+        internal static int GetObjectModel(int obj) => NativeApi.GetObjectModel(obj);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetObjectModel(int obj, int model);
+        internal static void SetObjectModel(int obj, int model) => NativeApi.SetObjectModel(obj, model);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetObjectRotateAxis(int obj, double x, double y, double z);
+        internal static void SetObjectRotateAxis(int obj, double x, double y, double z) => NativeApi.SetObjectRotateAxis(obj, x, y, z);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void StopObjectMove(int obj);
+        internal static void StopObjectMove(int obj) => NativeApi.StopObjectMove(obj);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetObjectMoveTo(int obj, double x, double y, double z, double speed);
+        internal static void SetObjectMoveTo(int obj, double x, double y, double z, double speed) => NativeApi.SetObjectMoveTo(obj, x, y, z, speed);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsObjectMoving(int obj);
+        internal static bool IsObjectMoving(int obj) => NativeApi.IsObjectMoving(obj) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void GetObjectAttachmentInfo(int obj, ref int attachType, ref int entity);
+        internal static void GetObjectAttachmentInfo(int obj, ref int attachType, ref int entity)
+        {
+            fixed (int* attachTypePtr = &attachType, entityPtr = &entity)
+            {
+                NativeApi.GetObjectAttachmentInfo(obj, attachTypePtr, entityPtr);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsObjectAttached(int obj);
+        internal static bool IsObjectAttached(int obj) => NativeApi.IsObjectAttached(obj) != 0;
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetObjectAttached(int obj, int attachType, int entity, double x, double y, double z,
-            double rx, double ry, double rz, [MarshalAs(UnmanagedType.LPStr)] string socketName);
+        internal static void SetObjectAttached(int obj, int attachType, int entity, double x, double y, double z,
+            double rx, double ry, double rz, string socketName)
+        {
+            fixed (byte* ptr = Utf8.Encode(socketName, out int length))
+            {
+                NativeApi.SetObjectAttachedUtf8(obj, attachType, entity, x, y, z, rx, ry, rz, ptr, length);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetObjectDetached(int obj);
+        internal static void SetObjectDetached(int obj) => NativeApi.SetObjectDetached(obj);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void GetObjectScale(int obj, ref double x, ref double y, ref double z);
+        internal static void GetObjectScale(int obj, ref double x, ref double y, ref double z)
+        {
+            fixed (double* xPtr = &x, yPtr = &y, zPtr = &z)
+            {
+                NativeApi.GetObjectScale(obj, xPtr, yPtr, zPtr);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetObjectScale(int obj, double x, double y, double z);
+        internal static void SetObjectScale(int obj, double x, double y, double z) => NativeApi.SetObjectScale(obj, x, y, z);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void GetObjectRotation(int obj, ref double x, ref double y, ref double z);
+        internal static void GetObjectRotation(int obj, ref double x, ref double y, ref double z)
+        {
+            fixed (double* xPtr = &x, yPtr = &y, zPtr = &z)
+            {
+                NativeApi.GetObjectRotation(obj, xPtr, yPtr, zPtr);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetObjectRotation(int obj, double x, double y, double z);
+        internal static void SetObjectRotation(int obj, double x, double y, double z) => NativeApi.SetObjectRotation(obj, x, y, z);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetObjectStreamDistance(int obj, double distance);
+        internal static void SetObjectStreamDistance(int obj, double distance) => NativeApi.SetObjectStreamDistance(obj, distance);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetNPCFollowVehicle(int npc, int vehicle, double speed);
+        internal static void SetNPCFollowVehicle(int npc, int vehicle, double speed) => NativeApi.SetNPCFollowVehicle(npc, vehicle, speed);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetNPCFollowPlayer(int npc, int player, double speed);
+        internal static void SetNPCFollowPlayer(int npc, int player, double speed) => NativeApi.SetNPCFollowPlayer(npc, player, speed);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetNPCTargetLocation(int npc, double x, double y, double z, double speed);
+        internal static void SetNPCTargetLocation(int npc, double x, double y, double z, double speed) => NativeApi.SetNPCTargetLocation(npc, x, y, z, speed);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetNPCHeading(int npc, double heading);
+        internal static void SetNPCHeading(int npc, double heading) => NativeApi.SetNPCHeading(npc, heading);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetNPCHeading(int npc);
+        internal static double GetNPCHeading(int npc) => NativeApi.GetNPCHeading(npc);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetNPCAnimation(int npc, [MarshalAs(UnmanagedType.LPStr)] string animation, bool loop);
+        internal static void SetNPCAnimation(int npc, string animation, bool loop)
+        {
+            fixed (byte* ptr = Utf8.Encode(animation, out int length))
+            {
+                NativeApi.SetNPCAnimationUtf8(npc, ptr, length, NativeApi.FromBool(loop));
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetNPCHealth(int npc, double health);
+        internal static void SetNPCHealth(int npc, double health) => NativeApi.SetNPCHealth(npc, health);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetNPCHealth(int npc);
+        internal static double GetNPCHealth(int npc) => NativeApi.GetNPCHealth(npc);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsStreamedIn([MarshalAs(UnmanagedType.LPStr)] string name, int player, int entity);
+        internal static bool IsStreamedIn(EntityType type, int player, int entity) => NativeApi.IsStreamedIn((int) type, player, entity) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int CreateNPC(double x, double y, double z, double heading);
+        internal static int CreateNPC(double x, double y, double z, double heading) => NativeApi.CreateNPC(x, y, z, heading);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetNPCRagdoll(int npc, bool enable);
+        internal static void SetNPCRagdoll(int npc, bool enable) => NativeApi.SetNPCRagdoll(npc, NativeApi.FromBool(enable));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetDoorModel(int door);
+        internal static int GetDoorModel(int door) => NativeApi.GetDoorModel(door);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetDoorOpen(int door, bool open);
+        internal static void SetDoorOpen(int door, bool open) => NativeApi.SetDoorOpen(door, NativeApi.FromBool(open));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool GetDoorOpen(int door);
+        internal static bool GetDoorOpen(int door) => NativeApi.GetDoorOpen(door) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int CreateDoor(int model, double x, double y, double z, double yaw, bool enableInteract);
+        internal static int CreateDoor(int model, double x, double y, double z, double yaw, bool enableInteract) => NativeApi.CreateDoor(model, x, y, z, yaw, NativeApi.FromBool(enableInteract));
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void DestroyEntity([MarshalAs(UnmanagedType.LPStr)] string entityName, int id);
+        internal static void DestroyEntity(EntityType type, int id) => NativeApi.DestroyEntity((int) type, id);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetEntityDimension([MarshalAs(UnmanagedType.LPStr)] string entityName, int id,
-            uint dim);
+        internal static void SetEntityDimension(EntityType type, int id, uint dim) => NativeApi.SetEntityDimension((int) type, id, dim);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern uint GetEntityDimension([MarshalAs(UnmanagedType.LPStr)] string entityName, int id);
+        internal static uint GetEntityDimension(EntityType type, int id) => NativeApi.GetEntityDimension((int) type, id);
         
         [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         internal static extern void GetNetworkStats(int source, ref int totalPacketLoss, ref int lastSecondPacketLoss,
@@ -385,165 +374,503 @@ namespace Onsharp.Native
             ref int totalBytesReceived, ref bool isLimitedByCongestionControl,
             ref bool isLimitedByOutgoingBandwidthLimit);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsTimerValid(int id);
+        internal static int RegisterLogSink(string directory)
+        {
+            fixed (byte* ptr = Utf8.Encode(directory, out int length))
+            {
+                return NativeApi.RegisterLogSinkUtf8(ptr, length);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void DestroyTimer(int id);
+        internal static bool WriteLog(int sink, int level, bool toConsole, string text)
+        {
+            fixed (byte* ptr = Utf8.Encode(text, out int length))
+            {
+                return NativeApi.WriteLogUtf8(sink, level, NativeApi.FromBool(toConsole), ptr, length) != 0;
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void PauseTimer(int id);
+        internal static long GetDroppedLogCount() => NativeApi.GetDroppedLogCount();
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void UnpauseTimer(int id);
+        internal static bool StartTrace(int seconds) => NativeApi.StartTrace(seconds) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetTimerRemainingTime(int id);
+        internal static bool IsTraceActive() => NativeApi.IsTraceActive() != 0;
         
         [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int CreateTimer([MarshalAs(UnmanagedType.LPStr)] string id, double interval);
+        internal static extern bool TraceBegin([MarshalAs(UnmanagedType.LPStr)] string name);
         
         [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void Delay([MarshalAs(UnmanagedType.LPStr)] string name, long millis);
+        internal static extern void TraceEnd([MarshalAs(UnmanagedType.LPStr)] string name);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool CreateExplosion(int id, double x, double y, double z, uint dim, bool soundEnabled,
-            double camShakeRadius, double radialForce, double damageRadius);
+        internal static void ConfigureTickMonitor(double thresholdMs) => NativeApi.ConfigureTickMonitor(thresholdMs);
         
         [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetMaxPlayers();
+        internal static extern int GetTickHistogram([Out] int[] counts, int capacity);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetServerName([MarshalAs(UnmanagedType.LPStr)] string name);
+        internal static void ConfigureNetworkSampler(float interval, int spreadTicks) => NativeApi.ConfigureNetworkSampler(interval, spreadTicks);
         
         [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetServerName();
+        internal static extern int GetNetworkStatsAggregate(int source, int field, int window, ref double min,
+            ref double max, ref double avg, ref double p95);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetServerTickRate();
+        internal static bool IsTimerValid(int id) => NativeApi.IsTimerValid(id) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetTheTickCount();
+        internal static void DestroyTimer(int id) => NativeApi.DestroyTimer(id);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetTimeSeconds();
+        internal static void PauseTimer(int id) => NativeApi.PauseTimer(id);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetDeltaSeconds();
+        internal static void UnpauseTimer(int id) => NativeApi.UnpauseTimer(id);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetGameVersion();
+        internal static double GetTimerRemainingTime(int id) => NativeApi.GetTimerRemainingTime(id);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetGameVersionAsString();
+        internal static int CreateTimer(string id, double interval)
+        {
+            fixed (byte* ptr = Utf8.Encode(id, out int length))
+            {
+                return NativeApi.CreateTimerUtf8(ptr, length, interval);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int CreateObject(int model, double x, double y, double z, double rx, double ry,
-            double rz, double sx, double sy, double sz);
+        internal static void Delay(string name, long millis)
+        {
+            fixed (byte* ptr = Utf8.Encode(name, out int length))
+            {
+                NativeApi.DelayUtf8(ptr, length, millis);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetAllPackages();
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsPackageStarted([MarshalAs(UnmanagedType.LPStr)] string name);
+        internal static bool CreateExplosion(int id, double x, double y, double z, uint dim, bool soundEnabled, double camShakeRadius, double radialForce, double damageRadius) => NativeApi.CreateExplosion(id, x, y, z, dim, NativeApi.FromBool(soundEnabled), camShakeRadius, radialForce, damageRadius) != 0;
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void StopPackage([MarshalAs(UnmanagedType.LPStr)] string name);
+        internal static int GetMaxPlayers() => NativeApi.GetMaxPlayers();
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void StartPackage([MarshalAs(UnmanagedType.LPStr)] string name);
+        internal static void SetServerName(string name)
+        {
+            fixed (byte* ptr = Utf8.Encode(name, out int length))
+            {
+                NativeApi.SetServerNameUtf8(ptr, length);
+            }
+        }
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetPlayerName(int player, [MarshalAs(UnmanagedType.LPStr)] string name);
+        internal static string GetServerName() => Utf8.Read(NativeApi.GetServerNameUtf8);
+        
+        internal static double GetServerTickRate() => NativeApi.GetServerTickRate();
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetPlayerName(int player);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SendPlayerChatMessage(int player, [MarshalAs(UnmanagedType.LPStr)] string message);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool IsEntityValid(int id, [MarshalAs(UnmanagedType.LPStr)] string name);
+        internal static double GetTheTickCount() => NativeApi.GetTheTickCount();
+        
+        internal static double GetTimeSeconds() => NativeApi.GetTimeSeconds();
+        
+        internal static double GetDeltaSeconds() => NativeApi.GetDeltaSeconds();
+        
+        internal static int GetGameVersion() => NativeApi.GetGameVersion();
+        
+        internal static string GetGameVersionAsString() => Utf8.Read(NativeApi.GetGameVersionAsStringUtf8);
+        
+        internal static PlayerStatus GetPlayerStatus(int id)
+        {
+            PlayerStatus status = default;
+            NativeApi.GetPlayerStatuses(&id, 1, &status);
+            return status;
+        }
+        
+        internal static int GetPlayerStatuses(int[] ids, PlayerStatus[] statuses)
+        {
+            if (ids.Length == 0) return 0;
+            fixed (int* idsPtr = ids)
+            fixed (PlayerStatus* statusesPtr = statuses)
+            {
+                return NativeApi.GetPlayerStatuses(idsPtr, ids.Length, statusesPtr);
+            }
+        }
+        
+        internal static VehicleStatus GetVehicleStatus(int id)
+        {
+            VehicleStatus status = default;
+            NativeApi.GetVehicleStatuses(&id, 1, &status);
+            return status;
+        }
+        
+        internal static int GetVehicleStatuses(int[] ids, VehicleStatus[] statuses)
+        {
+            if (ids.Length == 0) return 0;
+            fixed (int* idsPtr = ids)
+            fixed (VehicleStatus* statusesPtr = statuses)
+            {
+                return NativeApi.GetVehicleStatuses(idsPtr, ids.Length, statusesPtr);
+            }
+        }
+        
+        internal static NPCStatus GetNPCStatus(int id)
+        {
+            NPCStatus status = default;
+            NativeApi.GetNPCStatuses(&id, 1, &status);
+            return status;
+        }
+        
+        internal static int GetNPCStatuses(int[] ids, NPCStatus[] statuses)
+        {
+            if (ids.Length == 0) return 0;
+            fixed (int* idsPtr = ids)
+            fixed (NPCStatus* statusesPtr = statuses)
+            {
+                return NativeApi.GetNPCStatuses(idsPtr, ids.Length, statusesPtr);
+            }
+        }
+        
+        internal static int LoadWorldLayout(string path, uint dimension, int perTick)
+        {
+            fixed (byte* ptr = Utf8.Encode(path, out int length))
+            {
+                return NativeApi.LoadWorldLayoutUtf8(ptr, length, dimension, perTick);
+            }
+        }
+        
+        internal static int GetWorldLayoutIds(int layout, int[] ids, int[] types)
+        {
+            fixed (int* idsPtr = ids)
+            fixed (int* typesPtr = types)
+            {
+                return NativeApi.GetWorldLayoutIds(layout, idsPtr, typesPtr, ids.Length);
+            }
+        }
+        
+        internal static void ReleaseWorldLayout(int layout) => NativeApi.ReleaseWorldLayout(layout);
+        
+        internal static int OpenStore(string path)
+        {
+            fixed (byte* ptr = Utf8.Encode(path, out int length))
+            {
+                return NativeApi.OpenStoreUtf8(ptr, length);
+            }
+        }
+        
+        internal static bool CloseStore(int store) => NativeApi.CloseStore(store) != 0;
+        
+        internal static void PutStoreValue(int store, string key, byte[] value)
+        {
+            fixed (byte* keyPtr = Utf8.Encode(key, out int keyLength))
+            fixed (byte* valuePtr = value)
+            {
+                NativeApi.PutStoreValue(store, keyPtr, keyLength, valuePtr, value.Length);
+            }
+        }
+        
+        internal static void RemoveStoreValue(int store, string key)
+        {
+            fixed (byte* keyPtr = Utf8.Encode(key, out int keyLength))
+            {
+                NativeApi.RemoveStoreValue(store, keyPtr, keyLength);
+            }
+        }
+        
+        internal static byte[] GetStoreValue(int store, string key)
+        {
+            fixed (byte* keyPtr = Utf8.Encode(key, out int keyLength))
+            {
+                while (true)
+                {
+                    int length = NativeApi.GetStoreValue(store, keyPtr, keyLength, null, 0);
+                    if (length < 0) return null;
+                    byte[] value = new byte[length];
+                    fixed (byte* valuePtr = value)
+                    {
+                        // another thread may have replaced the value in between, then the length has to be read again
+                        if (NativeApi.GetStoreValue(store, keyPtr, keyLength, valuePtr, length) == length)
+                            return value;
+                    }
+                }
+            }
+        }
+        
+        internal static int GetStoreCount(int store) => NativeApi.GetStoreCount(store);
+        
+        internal static bool FlushStore(int store) => NativeApi.FlushStore(store) != 0;
+        
+        internal static void ConfigureWorldSnapshots(float interval) => NativeApi.ConfigureWorldSnapshots(interval);
+        
+        internal static int RestoreWorldSnapshot(int perTick) => NativeApi.RestoreWorldSnapshot(perTick);
+        
+        internal static IntPtr StartBridgeRecording(string path, long maxBytes)
+        {
+            fixed (byte* ptr = Utf8.Encode(path, out int length))
+            {
+                return NativeApi.StartBridgeRecordingUtf8(ptr, length, maxBytes);
+            }
+        }
+        
+        internal static bool StopBridgeRecording() => NativeApi.StopBridgeRecording() != 0;
+        
+        internal static void SetEntityPersistent(EntityType type, int id, bool persistent) => NativeApi.SetEntityPersistent((int) type, id, NativeApi.FromBool(persistent));
+        
+        internal static int CreateObject(int model, double x, double y, double z, double rx, double ry, double rz, double sx, double sy, double sz) => NativeApi.CreateObject(model, x, y, z, rx, ry, rz, sx, sy, sz);
+        
+        internal static IntPtr GetAllPackages() => NativeApi.GetAllPackages();
+        
+        internal static bool IsPackageStarted(string name)
+        {
+            fixed (byte* ptr = Utf8.Encode(name, out int length))
+            {
+                return NativeApi.IsPackageStartedUtf8(ptr, length) != 0;
+            }
+        }
+        
+        internal static void StopPackage(string name)
+        {
+            fixed (byte* ptr = Utf8.Encode(name, out int length))
+            {
+                NativeApi.StopPackageUtf8(ptr, length);
+            }
+        }
+        
+        internal static void StartPackage(string name)
+        {
+            fixed (byte* ptr = Utf8.Encode(name, out int length))
+            {
+                NativeApi.StartPackageUtf8(ptr, length);
+            }
+        }
+        
+        internal static void SetPlayerName(int player, string name)
+        {
+            fixed (byte* ptr = Utf8.Encode(name, out int length))
+            {
+                NativeApi.SetPlayerNameUtf8(player, ptr, length);
+            }
+        }
+        
+        internal static string GetPlayerName(int player) => Utf8.Read(NativeApi.GetPlayerNameUtf8, player);
+        
+        internal static void SendPlayerChatMessage(int player, string message)
+        {
+            fixed (byte* ptr = Utf8.Encode(message, out int length))
+            {
+                NativeApi.SendPlayerChatMessageUtf8(player, ptr, length);
+            }
+        }
+        
+        internal static bool IsEntityValid(int id, EntityType type) => NativeApi.IsEntityValid(id, (int) type) != 0;
+        
+        internal static int GetEntityCount(EntityType type) => NativeApi.GetEntityCount((int) type);
+        
+        internal static int GetEntities(EntityType type, int[] buffer, int size)
+        {
+            fixed (int* ptr = buffer)
+            {
+                return NativeApi.GetEntities((int) type, ptr, size);
+            }
+        }
+        
+        internal static int GetDimensionMembers(uint dimension, EntityType type, int[] buffer, int size)
+        {
+            fixed (int* ptr = buffer)
+            {
+                return NativeApi.GetDimensionMembers(dimension, (int) type, ptr, size);
+            }
+        }
+        
+        internal static void GetEntityDimensions(EntityType type, int[] ids, uint[] dimensions, int count)
+        {
+            fixed (int* idsPtr = ids)
+            fixed (uint* dimensionsPtr = dimensions)
+            {
+                NativeApi.GetEntityDimensions((int) type, idsPtr, dimensionsPtr, count);
+            }
+        }
+        
+        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int ComputeDistanceMask(float[] xs, float[] ys, float[] zs, int count, float px, float py,
+            float pz, float radius, [Out] byte[] mask);
+        
+        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
+        internal static extern int ComputePairsWithinRadius(float[] xs, float[] ys, float[] zs, int count, float radius,
+            [Out] int[] first, [Out] int[] second, int maxPairs);
+        
+        internal static int QueryEntitiesInRadius(uint dimension, double x, double y, double z, double radius, int typeMask,
+            int[] ids, int[] types, int size)
+        {
+            fixed (int* idsPtr = ids, typesPtr = types)
+            {
+                return NativeApi.QueryEntitiesInRadius(dimension, x, y, z, radius, typeMask, idsPtr, typesPtr, size);
+            }
+        }
+        
+        internal static int QueryEntitiesInBox(uint dimension, double minX, double minY, double minZ, double maxX,
+            double maxY, double maxZ, int typeMask, int[] ids, int[] types, int size)
+        {
+            fixed (int* idsPtr = ids, typesPtr = types)
+            {
+                return NativeApi.QueryEntitiesInBox(dimension, minX, minY, minZ, maxX, maxY, maxZ, typeMask, idsPtr, typesPtr, size);
+            }
+        }
+        
+        internal static int QueryNearestEntities(uint dimension, double x, double y, double z, int typeMask, int k,
+            int[] ids, int[] types, double[] distances)
+        {
+            fixed (int* idsPtr = ids, typesPtr = types)
+            fixed (double* distancesPtr = distances)
+            {
+                return NativeApi.QueryNearestEntities(dimension, x, y, z, typeMask, k, idsPtr, typesPtr, distancesPtr);
+            }
+        }
         
         [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         internal static extern IntPtr[] GetKeysFromTable(IntPtr table);
         
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void AddValueToTable(IntPtr table, IntPtr key, IntPtr val);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void RemoveTableKey(IntPtr table, IntPtr key);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool ContainsTableKey(IntPtr table, IntPtr key);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetValueFromTable(IntPtr table, IntPtr key);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetLengthOfTable(IntPtr table);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr[] InvokePackage([MarshalAs(UnmanagedType.LPStr)] string importId, [MarshalAs(UnmanagedType.LPStr)] string funcName, IntPtr[] nVals, int len);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void ImportPackage([MarshalAs(UnmanagedType.LPStr)] string packageName);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void SetEntityPosition(int id, [MarshalAs(UnmanagedType.LPStr)] string name, double x, double y, double z);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void GetEntityPosition(int id, [MarshalAs(UnmanagedType.LPStr)] string name, ref double x, ref double y, ref double z);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void ShutdownServer();
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void RegisterRemoteEvent([MarshalAs(UnmanagedType.LPStr)] string pluginId, [MarshalAs(UnmanagedType.LPStr)] string eventName);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void RegisterCommand([MarshalAs(UnmanagedType.LPStr)] string pluginId, [MarshalAs(UnmanagedType.LPStr)] string commandName);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void RegisterCommandAlias([MarshalAs(UnmanagedType.LPStr)] string pluginId, [MarshalAs(UnmanagedType.LPStr)] string commandName, [MarshalAs(UnmanagedType.LPStr)] string alias);
-        
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void CallRemote(int player, [MarshalAs(UnmanagedType.LPStr)] string name, IntPtr[] nVals, int len);
-        
-        [DllImport(Bridge.DllName, EntryPoint = "CreateNValue_s", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr CreateNValue([MarshalAs(UnmanagedType.LPStr)] string val);
+        internal static void AddValueToTable(IntPtr table, IntPtr key, IntPtr val) => NativeApi.AddValueToTable(table, key, val);
+        
+        internal static void RemoveTableKey(IntPtr table, IntPtr key) => NativeApi.RemoveTableKey(table, key);
+        
+        internal static bool ContainsTableKey(IntPtr table, IntPtr key) => NativeApi.ContainsTableKey(table, key) != 0;
+        
+        internal static IntPtr GetValueFromTable(IntPtr table, IntPtr key) => NativeApi.GetValueFromTable(table, key);
+        
+        internal static int GetLengthOfTable(IntPtr table) => NativeApi.GetLengthOfTable(table);
+        
+        internal static int ResolvePackageFunction(string importId, string funcName)
+        {
+            byte[] idBytes = Utf8.GetName(importId);
+            fixed (byte* idPtr = idBytes)
+            fixed (byte* namePtr = Utf8.Encode(funcName, out int nameLength))
+            {
+                return NativeApi.ResolvePackageFunctionUtf8(idPtr, idBytes.Length, namePtr, nameLength);
+            }
+        }
+        
+        internal static int InvokePackageFunction(int handle, IntPtr[] nVals, int len, IntPtr[] results, int resultLen)
+        {
+            fixed (IntPtr* valsPtr = nVals, resultsPtr = results)
+            {
+                return NativeApi.InvokePackageFunction(handle, valsPtr, len, resultsPtr, resultLen);
+            }
+        }
+        
+        internal static void ImportPackage(string importId, string packageName)
+        {
+            byte[] idBytes = Utf8.GetName(importId);
+            fixed (byte* idPtr = idBytes)
+            fixed (byte* namePtr = Utf8.Encode(packageName, out int nameLength))
+            {
+                NativeApi.ImportPackageUtf8(idPtr, idBytes.Length, namePtr, nameLength);
+            }
+        }
+        
+        internal static void SetEntityPosition(int id, EntityType type, double x, double y, double z) => NativeApi.SetEntityPosition(id, (int) type, x, y, z);
+        
+        internal static void GetEntityPosition(int id, EntityType type, ref double x, ref double y, ref double z)
+        {
+            fixed (double* xPtr = &x, yPtr = &y, zPtr = &z)
+            {
+                NativeApi.GetEntityPosition(id, (int) type, xPtr, yPtr, zPtr);
+            }
+        }
+        
+        internal static void ShutdownServer() => NativeApi.ShutdownServer();
+        
+        internal static void RegisterRemoteEvent(string pluginId, string eventName)
+        {
+            byte[] idBytes = Utf8.GetName(pluginId);
+            fixed (byte* idPtr = idBytes)
+            fixed (byte* namePtr = Utf8.Encode(eventName, out int nameLength))
+            {
+                NativeApi.RegisterRemoteEventUtf8(idPtr, idBytes.Length, namePtr, nameLength);
+            }
+        }
+        
+        internal static int RegisterCommand(string commandName)
+        {
+            fixed (byte* ptr = Utf8.Encode(commandName, out int length))
+            {
+                return NativeApi.RegisterCommandUtf8(ptr, length);
+            }
+        }
+        
+        internal static void RegisterCommandAlias(int handle, string alias)
+        {
+            fixed (byte* ptr = Utf8.Encode(alias, out int length))
+            {
+                NativeApi.RegisterCommandAliasUtf8(handle, ptr, length);
+            }
+        }
+        
+        internal static void CallRemote(int player, string name, IntPtr[] nVals, int len)
+        {
+            byte[] nameBytes = Utf8.GetName(name);
+            fixed (byte* namePtr = nameBytes)
+            fixed (IntPtr* valsPtr = nVals)
+            {
+                NativeApi.CallRemoteUtf8(player, namePtr, nameBytes.Length, valsPtr, len);
+            }
+        }
+        
+        internal static void QueueRemote(int player, string name, IntPtr[] nVals, int len, bool state)
+        {
+            byte[] nameBytes = Utf8.GetName(name);
+            fixed (byte* namePtr = nameBytes)
+            fixed (IntPtr* valsPtr = nVals)
+            {
+                NativeApi.QueueRemoteUtf8(player, namePtr, nameBytes.Length, valsPtr, len, NativeApi.FromBool(state));
+            }
+        }
+        
+        internal static void CallRemoteMulticast(int[] players, int count, string name, IntPtr[] nVals, int len)
+        {
+            byte[] nameBytes = Utf8.GetName(name);
+            fixed (int* playersPtr = players)
+            fixed (byte* namePtr = nameBytes)
+            fixed (IntPtr* valsPtr = nVals)
+            {
+                NativeApi.CallRemoteMulticastUtf8(playersPtr, count, namePtr, nameBytes.Length, valsPtr, len);
+            }
+        }
+        
+        internal static void CallRemoteBroadcast(string name, IntPtr[] nVals, int len)
+        {
+            byte[] nameBytes = Utf8.GetName(name);
+            fixed (byte* namePtr = nameBytes)
+            fixed (IntPtr* valsPtr = nVals)
+            {
+                NativeApi.CallRemoteBroadcastUtf8(namePtr, nameBytes.Length, valsPtr, len);
+            }
+        }
+        
+        internal static void CallRemoteDimension(uint dimension, string name, IntPtr[] nVals, int len)
+        {
+            byte[] nameBytes = Utf8.GetName(name);
+            fixed (byte* namePtr = nameBytes)
+            fixed (IntPtr* valsPtr = nVals)
+            {
+                NativeApi.CallRemoteDimensionUtf8(dimension, namePtr, nameBytes.Length, valsPtr, len);
+            }
+        }
+        
+        internal static IntPtr CreateNValue(string val)
+        {
+            fixed (byte* ptr = Utf8.Encode(val, out int length))
+            {
+                return NativeApi.CreateNValue_u8(ptr, length);
+            }
+        }
 
-        [DllImport(Bridge.DllName, EntryPoint = "CreateNValue_i", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr CreateNValue(int val);
+        internal static IntPtr CreateNValue(int val) => NativeApi.CreateNValue_i(val);
 
-        [DllImport(Bridge.DllName, EntryPoint = "CreateNValue_d", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr CreateNValue(double val);
+        internal static IntPtr CreateNValue(double val) => NativeApi.CreateNValue_d(val);
 
-        [DllImport(Bridge.DllName, EntryPoint = "CreateNValue_b", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr CreateNValue(bool val);
+        internal static IntPtr CreateNValue(bool val) => NativeApi.CreateNValue_b(NativeApi.FromBool(val));
 
-        [DllImport(Bridge.DllName, EntryPoint = "CreateNValue_n", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr CreateNValue();
+        internal static IntPtr CreateNValue() => NativeApi.CreateNValue_n();
 
-        [DllImport(Bridge.DllName, EntryPoint = "CreateNValue_t", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr CreateNValueTable();
+        internal static IntPtr CreateNValueTable() => NativeApi.CreateNValue_t();
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern void FreeNValue(IntPtr ptr);
+        internal static void FreeNValue(IntPtr ptr) => NativeApi.FreeNValue(ptr);
 
         [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
         internal static extern NativeValue.Type GetNType(IntPtr ptr);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern double GetNDouble(IntPtr ptr);
+        internal static double GetNDouble(IntPtr ptr) => NativeApi.GetNDouble(ptr);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern int GetNInt(IntPtr ptr);
+        internal static int GetNInt(IntPtr ptr) => NativeApi.GetNInt(ptr);
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern bool GetNBoolean(IntPtr ptr);
+        internal static bool GetNBoolean(IntPtr ptr) => NativeApi.GetNBoolean(ptr) != 0;
 
-        [DllImport(Bridge.DllName, CharSet = CharSet.Unicode, CallingConvention = CallingConvention.Cdecl)]
-        internal static extern IntPtr GetNString(IntPtr ptr);
+        internal static IntPtr GetNString(IntPtr ptr) => NativeApi.GetNString(ptr);
     }
 }
\ No newline at end of file
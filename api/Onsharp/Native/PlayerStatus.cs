@@ -0,0 +1,91 @@
+﻿using System.Runtime.InteropServices;
+using Onsharp.Enums;
+using Onsharp.World;
+
+namespace Onsharp.Native
+{
+    /// <summary>
+    /// The commonly read values of a player, like the ones a scoreboard or an admin panel needs.
+    /// The layout is shared with the native runtime, which fills it in one call.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Size = 80)]
+    public struct PlayerStatus
+    {
+        /// <summary>
+        /// The x coordinate of the position.
+        /// </summary>
+        public double X { get; }
+
+        /// <summary>
+        /// The y coordinate of the position.
+        /// </summary>
+        public double Y { get; }
+
+        /// <summary>
+        /// The z coordinate of the position.
+        /// </summary>
+        public double Z { get; }
+
+        /// <summary>
+        /// The heading of the player.
+        /// </summary>
+        public double Heading { get; }
+
+        /// <summary>
+        /// The health of the player.
+        /// </summary>
+        public double Health { get; }
+
+        /// <summary>
+        /// The armor of the player.
+        /// </summary>
+        public double Armor { get; }
+
+        /// <summary>
+        /// The id of the player.
+        /// </summary>
+        public int Id { get; }
+
+        private readonly int _valid;
+
+        /// <summary>
+        /// The id of the vehicle the player is in, or zero.
+        /// </summary>
+        public int Vehicle { get; }
+
+        /// <summary>
+        /// The seat of the player in the vehicle.
+        /// </summary>
+        public int Seat { get; }
+
+        /// <summary>
+        /// The ping of the player.
+        /// </summary>
+        public int Ping { get; }
+
+        /// <summary>
+        /// The state of the player.
+        /// </summary>
+        public PlayerState State { get; }
+
+        /// <summary>
+        /// The movement mode of the player.
+        /// </summary>
+        public MoveMode MoveMode { get; }
+
+        /// <summary>
+        /// The dimension the player is in.
+        /// </summary>
+        public uint Dimension { get; }
+
+        /// <summary>
+        /// True, if the entity was valid when the status was read. All other values are zero otherwise.
+        /// </summary>
+        public bool IsValid => _valid != 0;
+
+        /// <summary>
+        /// The position at the time the status was read.
+        /// </summary>
+        public Vector Position => new Vector(X, Y, Z);
+    }
+}
@@ -24,5 +24,45 @@
         /// Whether the metrics system is enabled on this server or not.
         /// </summary>
         public bool MetricsEnabled { get; set; } = true;
+
+        /// <summary>
+        /// The interval in seconds in which the native runtime samples the network stats. Zero disables the sampler.
+        /// </summary>
+        public double NetworkSampleInterval { get; set; } = 1;
+
+        /// <summary>
+        /// The count of ticks over which the sampling of all players is spread.
+        /// </summary>
+        public int NetworkSampleSpreadTicks { get; set; } = 10;
+
+        /// <summary>
+        /// The duration in milliseconds above which a server tick or an event dispatch is dumped into the log together
+        /// with the bridge calls, events and Lua functions it ran. Zero disables the dumps.
+        /// </summary>
+        public double SlowTickThreshold { get; set; } = 50;
+
+        /// <summary>
+        /// The interval in seconds in which the native runtime writes a snapshot of the persistent vehicles, objects and
+        /// NPCs to the data folder, see <see cref="Onsharp.Entities.Entity.SetPersistent"/>. Zero disables the snapshots.
+        /// </summary>
+        public double WorldSnapshotInterval { get; set; } = 0;
+
+        /// <summary>
+        /// Whether the entities of the snapshot left behind by a crashed server should be spawned again on start.
+        /// </summary>
+        public bool RestoreWorldSnapshot { get; set; } = true;
+
+        /// <summary>
+        /// Whether the bridge calls, the native api calls and the ticks should be recorded into the recordings folder
+        /// of the logs. A recording can be replayed with the OnsharpReplay tool of the runtime benchmarks. The trace and
+        /// network statistics calls and the distance helpers are not recorded. The recording can be stopped with the
+        /// stoprecording console command.
+        /// </summary>
+        public bool RecordBridgeTraffic { get; set; } = false;
+
+        /// <summary>
+        /// The size in megabytes after which the recording of the bridge traffic stops. Zero records until the server stops.
+        /// </summary>
+        public int BridgeRecordingLimit { get; set; } = 512;
     }
 }
\ No newline at end of file
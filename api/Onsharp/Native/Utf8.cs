@@ -0,0 +1,114 @@
+﻿using System;
+using System.Collections.Concurrent;
+using System.Text;
+
+namespace Onsharp.Native
+{
+    /// <summary>
+    /// Encodes strings into reused utf-8 buffers which are passed to the native runtime as pointer and length, so no
+    /// buffer is allocated per call. The native side copies the bytes before it calls back into managed code, which is
+    /// why one buffer per thread is enough. Names which are sent over and over again, like remote events, are cached.
+    /// </summary>
+    internal static unsafe class Utf8
+    {
+        private const int MaxCachedNames = 4096;
+
+        [ThreadStatic]
+        private static byte[] _buffer;
+
+        private static readonly ConcurrentDictionary<string, byte[]> Names = new ConcurrentDictionary<string, byte[]>();
+
+        /// <summary>
+        /// Encodes the given string into the buffer of the calling thread. The buffer is only valid until the next call.
+        /// </summary>
+        /// <param name="value">The string to be encoded</param>
+        /// <param name="length">The count of bytes the string takes in the buffer</param>
+        /// <returns>The buffer of the calling thread</returns>
+        internal static byte[] Encode(string value, out int length)
+        {
+            byte[] buffer = _buffer ??= new byte[256];
+            if (string.IsNullOrEmpty(value))
+            {
+                length = 0;
+                return buffer;
+            }
+
+            int maxLength = Encoding.UTF8.GetMaxByteCount(value.Length);
+            if (maxLength > buffer.Length)
+            {
+                buffer = _buffer = new byte[Math.Max(maxLength, buffer.Length * 2)];
+            }
+
+            length = Encoding.UTF8.GetBytes(value, 0, value.Length, buffer, 0);
+            return buffer;
+        }
+
+        /// <summary>
+        /// Reads a string by the given native getter which copies it into the buffer of the calling thread. If the
+        /// buffer is too small, it is grown to the size the getter returned and the getter is called again.
+        /// </summary>
+        /// <param name="getter">The native getter taking the entity, the buffer and its size</param>
+        /// <param name="id">The id of the entity</param>
+        /// <returns>The string or null, if the native value is no string</returns>
+        internal static string Read(delegate* unmanaged[Cdecl]<int, byte*, int, int> getter, int id)
+        {
+            while (true)
+            {
+                byte[] buffer = _buffer ??= new byte[256];
+                int length;
+                fixed (byte* ptr = buffer)
+                {
+                    length = getter(id, ptr, buffer.Length);
+                    if (length < 0)
+                        return null;
+
+                    if (length <= buffer.Length)
+                        return Encoding.UTF8.GetString(ptr, length);
+                }
+
+                _buffer = new byte[Math.Max(length, buffer.Length * 2)];
+            }
+        }
+
+        /// <summary>
+        /// Reads a string by the given native getter which takes no entity, see <see cref="Read(delegate* unmanaged[Cdecl]{int, byte*, int, int}, int)"/>.
+        /// </summary>
+        /// <param name="getter">The native getter taking the buffer and its size</param>
+        /// <returns>The string or null, if the native value is no string</returns>
+        internal static string Read(delegate* unmanaged[Cdecl]<byte*, int, int> getter)
+        {
+            while (true)
+            {
+                byte[] buffer = _buffer ??= new byte[256];
+                int length;
+                fixed (byte* ptr = buffer)
+                {
+                    length = getter(ptr, buffer.Length);
+                    if (length < 0)
+                        return null;
+
+                    if (length <= buffer.Length)
+                        return Encoding.UTF8.GetString(ptr, length);
+                }
+
+                _buffer = new byte[Math.Max(length, buffer.Length * 2)];
+            }
+        }
+
+        /// <summary>
+        /// Returns the encoded bytes of the given name, which are cached until the cache is full.
+        /// </summary>
+        /// <param name="name">The name to be encoded</param>
+        internal static byte[] GetName(string name)
+        {
+            if (Names.TryGetValue(name, out byte[] bytes))
+                return bytes;
+
+            bytes = Encoding.UTF8.GetBytes(name);
+            if (Names.Count < MaxCachedNames)
+                Names.TryAdd(name, bytes);
+
+            return bytes;
+        }
+    }
+}
@@ -0,0 +1,129 @@
+﻿using System.Runtime.InteropServices;
+using Onsharp.World;
+
+namespace Onsharp.Native
+{
+    /// <summary>
+    /// The commonly read values of a vehicle.
+    /// The layout is shared with the native runtime, which fills it in one call.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential, Size = 120)]
+    public struct VehicleStatus
+    {
+        /// <summary>
+        /// The x coordinate of the position.
+        /// </summary>
+        public double X { get; }
+
+        /// <summary>
+        /// The y coordinate of the position.
+        /// </summary>
+        public double Y { get; }
+
+        /// <summary>
+        /// The z coordinate of the position.
+        /// </summary>
+        public double Z { get; }
+
+        /// <summary>
+        /// The pitch of the rotation.
+        /// </summary>
+        public double RotationX { get; }
+
+        /// <summary>
+        /// The yaw of the rotation.
+        /// </summary>
+        public double RotationY { get; }
+
+        /// <summary>
+        /// The roll of the rotation.
+        /// </summary>
+        public double RotationZ { get; }
+
+        /// <summary>
+        /// The x component of the velocity.
+        /// </summary>
+        public double VelocityX { get; }
+
+        /// <summary>
+        /// The y component of the velocity.
+        /// </summary>
+        public double VelocityY { get; }
+
+        /// <summary>
+        /// The z component of the velocity.
+        /// </summary>
+        public double VelocityZ { get; }
+
+        /// <summary>
+        /// The heading of the vehicle.
+        /// </summary>
+        public double Heading { get; }
+
+        /// <summary>
+        /// The health of the vehicle.
+        /// </summary>
+        public double Health { get; }
+
+        /// <summary>
+        /// The id of the vehicle.
+        /// </summary>
+        public int Id { get; }
+
+        private readonly int _valid;
+
+        /// <summary>
+        /// The model of the vehicle.
+        /// </summary>
+        public int Model { get; }
+
+        /// <summary>
+        /// The id of the driving player, or zero.
+        /// </summary>
+        public int Driver { get; }
+
+        private readonly int _engine;
+
+        /// <summary>
+        /// The current gear of the vehicle.
+        /// </summary>
+        public int Gear { get; }
+
+        private readonly int _light;
+
+        /// <summary>
+        /// The dimension the vehicle is in.
+        /// </summary>
+        public uint Dimension { get; }
+
+        /// <summary>
+        /// True, if the entity was valid when the status was read. All other values are zero otherwise.
+        /// </summary>
+        public bool IsValid => _valid != 0;
+
+        /// <summary>
+        /// True, if the engine was running when the status was read.
+        /// </summary>
+        public bool IsEngineRunning => _engine != 0;
+
+        /// <summary>
+        /// True, if the lights were enabled when the status was read.
+        /// </summary>
+        public bool IsLightEnabled => _light != 0;
+
+        /// <summary>
+        /// The position at the time the status was read.
+        /// </summary>
+        public Vector Position => new Vector(X, Y, Z);
+
+        /// <summary>
+        /// The rotation at the time the status was read.
+        /// </summary>
+        public Vector Rotation => new Vector(RotationX, RotationY, RotationZ);
+
+        /// <summary>
+        /// The velocity at the time the status was read.
+        /// </summary>
+        public Vector Velocity => new Vector(VelocityX, VelocityY, VelocityZ);
+    }
+}
@@ -250,6 +250,7 @@ namespace Onsharp.Plugins
             {
                 Plugin.Logger.Warn("Stopping plugin {NAME}...", Plugin.Display);
                 Plugin.OnStop();
+                (Plugin.Data as DataStorage)?.Close();
                 lock (PluginManager.Plugins)
                     PluginManager.Plugins.Remove(Plugin);
                 ChangePluginState(PluginState.Stopped);
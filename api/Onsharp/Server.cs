@@ -19,7 +19,7 @@ namespace Onsharp
     {
         #region Entity Types
 
-        private static readonly Type EntityType = typeof(Entity);
+        private static readonly Type EntityBaseType = typeof(Entity);
         private static readonly Type PlayerType = typeof(Player);
         private static readonly Type DoorType = typeof(Door);
         private static readonly Type NPCType = typeof(NPC);
@@ -34,7 +34,7 @@ namespace Onsharp
 
         public string Name
         {
-            get => Bridge.PtrToString(Onset.GetServerName());
+            get => Onset.GetServerName();
             set => Onset.SetServerName(value);
         }
 
@@ -44,21 +44,26 @@ namespace Onsharp
 
         public NetworkStats NetworkStats => Bridge.GetNetworkStats(0);
 
+        public NetworkStatSummary GetNetworkStatSummary(NetworkStatField field, int window = 0)
+        {
+            return Bridge.GetNetworkStatSummary(0, field, window);
+        }
+
         public Dimension this[uint val] => GetDimension(val);
 
-        public IReadOnlyList<Player> Players => PlayerPool.CastEntities<Player>();
+        public IReadOnlyList<Player> Players => PlayerPool.GetAllEntities<Player>();
         
-        public IReadOnlyList<Door> Doors => DoorPool.CastEntities<Door>();
+        public IReadOnlyList<Door> Doors => DoorPool.GetAllEntities<Door>();
         
-        public IReadOnlyList<NPC> NPCs => NPCPool.CastEntities<NPC>();
+        public IReadOnlyList<NPC> NPCs => NPCPool.GetAllEntities<NPC>();
         
-        public IReadOnlyList<Object> Objects => ObjectPool.CastEntities<Object>();
+        public IReadOnlyList<Object> Objects => ObjectPool.GetAllEntities<Object>();
         
-        public IReadOnlyList<Pickup> Pickups => PickupPool.CastEntities<Pickup>();
+        public IReadOnlyList<Pickup> Pickups => PickupPool.GetAllEntities<Pickup>();
         
-        public IReadOnlyList<Text3D> Text3Ds => Text3DPool.CastEntities<Text3D>();
+        public IReadOnlyList<Text3D> Text3Ds => Text3DPool.GetAllEntities<Text3D>();
         
-        public IReadOnlyList<Vehicle> Vehicles => VehiclePool.CastEntities<Vehicle>();
+        public IReadOnlyList<Vehicle> Vehicles => VehiclePool.GetAllEntities<Vehicle>();
         
         internal EntityPool PlayerPool { get; }    
 
@@ -107,19 +112,19 @@ namespace Onsharp
             _taskQueue = new ConcurrentQueue<Action>();
             Dimensions = new List<Dimension>();
             PlayerFactory = new PlayerFactory();
-            PlayerPool = new EntityPool(this, null, CreatePlayer);
+            PlayerPool = new EntityPool(this, EntityType.Player, CreatePlayer);
             DoorFactory = new DoorFactory();
-            DoorPool = new EntityPool(this, "Doors", CreateDoor);
+            DoorPool = new EntityPool(this, EntityType.Door, CreateDoor);
             NPCFactory = new NPCFactory();
-            NPCPool = new EntityPool(this, "NPC", CreateNPC);
+            NPCPool = new EntityPool(this, EntityType.NPC, CreateNPC);
             ObjectFactory = new ObjectFactory();
-            ObjectPool = new EntityPool(this, "Objects", CreateObject);
+            ObjectPool = new EntityPool(this, EntityType.Object, CreateObject);
             PickupFactory = new PickupFactory();
-            PickupPool = new EntityPool(this, "Pickups", CreatePickup);
+            PickupPool = new EntityPool(this, EntityType.Pickup, CreatePickup);
             Text3DFactory = new Text3DFactory();
-            Text3DPool = new EntityPool(this, "Text3D", CreateText3D);
+            Text3DPool = new EntityPool(this, EntityType.Text3D, CreateText3D);
             VehicleFactory = new VehicleFactory();
-            VehiclePool = new EntityPool(this, "Vehicles", CreateVehicle);
+            VehiclePool = new EntityPool(this, EntityType.Vehicle, CreateVehicle);
             ServerEvents = new List<ServerEvent>();
             RemoteEvents = new List<RemoteEvent>();
             Exportables = new List<LuaExport>();
@@ -320,8 +325,9 @@ namespace Onsharp
 
         public LuaPackage ImportPackage(string packageName)
         {
-            Onset.ImportPackage(packageName);
-            return new LuaPackage(Owner.Plugin.Meta.Id, packageName);
+            LuaPackage package = new LuaPackage(Owner.Plugin.Meta.Id, packageName);
+            Onset.ImportPackage(package.ImportId, packageName);
+            return package;
         }
 
         public void RegisterExportable(object owner)
@@ -359,6 +365,13 @@ namespace Onsharp
             Onset.ShutdownServer();
         }
 
+        public void CallRemote(string name, params object[] args)
+        {
+            IntPtr[] nVals = Bridge.CreateRemoteArgs(args);
+            Onset.CallRemoteBroadcast(name, nVals, nVals.Length);
+            Bridge.FreeNValues(args, nVals);
+        }
+
         public Dimension GetDimension(uint val)
         {
             return CreateDimension(val);
@@ -394,6 +407,11 @@ namespace Onsharp
             return _globalDim.CreateVehicle(model, pos, heading);
         }
 
+        public bool LoadLayout(string path, Action<IReadOnlyList<Entity>> onLoaded = null, int perTick = 500)
+        {
+            return _globalDim.LoadLayout(path, onLoaded, perTick);
+        }
+
         public void InvokeMainThread(Action callback)
         {                
             _taskQueue.Enqueue(callback);
@@ -472,7 +490,7 @@ namespace Onsharp
                         {
                             ParameterInfo parameter = parameters[j + 1];
                             object raw = nArgs[j];
-                            if (EntityType.IsAssignableFrom(parameter.ParameterType) && raw is int id)
+                            if (EntityBaseType.IsAssignableFrom(parameter.ParameterType) && raw is int id)
                             {
                                 raw = CreateTypedEntity(id, parameter.ParameterType);
                             }
@@ -487,9 +505,9 @@ namespace Onsharp
             }
         }
 
-        internal void FireCommand(int player, string name, string line)
+        internal void FireCommand(int player, string name, string[] tokens)
         {
-            _commandManager.ExecuteCommand(name, line, player);
+            _commandManager.ExecuteCommand(name, tokens, player);
         }
 
         internal bool CallEvent(EventType type, params object[] eventArgs)
@@ -509,15 +527,90 @@ namespace Onsharp
 
             if (type == EventType.GameTick)
             {
-                while (_taskQueue.TryDequeue(out Action callback))
+                RunQueuedTasks();
+            }
+
+            return flag;
+        }
+
+        /// <summary>
+        /// Calls the handlers of an event with a typed fast path. The handlers which take the exact arguments are
+        /// called without boxing them, all others get them as object array like on the generic path.
+        /// </summary>
+        internal bool CallEvent<T1>(EventType type, T1 arg1)
+        {
+            bool flag = true;
+            lock (ServerEvents)
+            {
+                foreach (ServerEvent @event in ServerEvents)
+                {
+                    if (@event.Type == type && !@event.FireEvent(arg1))
+                        flag = false;
+                }
+            }
+
+            if (type == EventType.GameTick)
+            {
+                RunQueuedTasks();
+            }
+
+            return flag;
+        }
+
+        internal bool CallEvent<T1, T2>(EventType type, T1 arg1, T2 arg2)
+        {
+            bool flag = true;
+            lock (ServerEvents)
+            {
+                foreach (ServerEvent @event in ServerEvents)
                 {
-                    callback.Invoke();
+                    if (@event.Type == type && !@event.FireEvent(arg1, arg2))
+                        flag = false;
                 }
             }
 
             return flag;
         }
 
+        internal bool CallEvent<T1, T2, T3>(EventType type, T1 arg1, T2 arg2, T3 arg3)
+        {
+            bool flag = true;
+            lock (ServerEvents)
+            {
+                foreach (ServerEvent @event in ServerEvents)
+                {
+                    if (@event.Type == type && !@event.FireEvent(arg1, arg2, arg3))
+                        flag = false;
+                }
+            }
+
+            return flag;
+        }
+
+        internal bool CallEvent<T1, T2, T3, T4, T5, T6, T7>(EventType type, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5,
+            T6 arg6, T7 arg7)
+        {
+            bool flag = true;
+            lock (ServerEvents)
+            {
+                foreach (ServerEvent @event in ServerEvents)
+                {
+                    if (@event.Type == type && !@event.FireEvent(arg1, arg2, arg3, arg4, arg5, arg6, arg7))
+                        flag = false;
+                }
+            }
+
+            return flag;
+        }
+
+        private void RunQueuedTasks()
+        {
+            while (_taskQueue.TryDequeue(out Action callback))
+            {
+                callback.Invoke();
+            }
+        }
+
         /// <summary>
         /// Creates an entity which will fit the needed attach type.
         /// </summary>
@@ -579,7 +672,7 @@ namespace Onsharp
         /// <returns>The wrapped player object</returns>
         internal Player CreatePlayer(int id)
         {
-            return PlayerPool.GetEntity(id, () => PlayerFactory.Create(id));
+            return PlayerPool.GetEntity(id, PlayerFactory);
         }
 
         /// <summary>
@@ -589,7 +682,7 @@ namespace Onsharp
         /// <returns>The wrapped door object</returns>
         internal Door CreateDoor(int id)
         {
-            return DoorPool.GetEntity(id, () => DoorFactory.Create(id));
+            return DoorPool.GetEntity(id, DoorFactory);
         }
 
         /// <summary>
@@ -599,7 +692,7 @@ namespace Onsharp
         /// <returns>The wrapped NPC object</returns>
         internal NPC CreateNPC(int id)
         {
-            return NPCPool.GetEntity(id, () => NPCFactory.Create(id));
+            return NPCPool.GetEntity(id, NPCFactory);
         }
 
         /// <summary>
@@ -609,7 +702,7 @@ namespace Onsharp
         /// <returns>The wrapped object</returns>
         internal Object CreateObject(int id)
         {
-            return ObjectPool.GetEntity(id, () => ObjectFactory.Create(id));
+            return ObjectPool.GetEntity(id, ObjectFactory);
         }
 
         /// <summary>
@@ -619,7 +712,7 @@ namespace Onsharp
         /// <returns>The wrapped pickup object</returns>
         internal Pickup CreatePickup(int id)
         {
-            return PickupPool.GetEntity(id, () => PickupFactory.Create(id));
+            return PickupPool.GetEntity(id, PickupFactory);
         }
 
         /// <summary>
@@ -629,7 +722,7 @@ namespace Onsharp
         /// <returns>The wrapped 3d text object</returns>
         internal Text3D CreateText3D(int id)
         {
-            return Text3DPool.GetEntity(id, () => Text3DFactory.Create(id));
+            return Text3DPool.GetEntity(id, Text3DFactory);
         }
 
         /// <summary>
@@ -639,7 +732,7 @@ namespace Onsharp
         /// <returns>The wrapped vehicle object</returns>
         internal Vehicle CreateVehicle(int id)
         {
-            return VehiclePool.GetEntity(id, () => VehicleFactory.Create(id));
+            return VehiclePool.GetEntity(id, VehicleFactory);
         }
 
         /// <summary>
@@ -1,6 +1,9 @@
 ﻿using System;
 using System.Collections.Generic;
+using System.Linq;
 using Onsharp.Entities;
+using Onsharp.Native;
+using Onsharp.World;
 
 namespace Onsharp.Utils
 {
@@ -231,10 +234,13 @@ namespace Onsharp.Utils
         /// <typeparam name="T">The type of the player</typeparam>
         public static void CallRemote<T>(this IReadOnlyList<T> list, string name, params object[] args) where T : Player
         {
-            list.SafeForEach(player =>
+            int[] players = new int[list.Count];
+            for (int i = 0; i < players.Length; i++)
             {
-                player.CallRemote(name, args);
-            });
+                players[i] = list[i].Id;
+            }
+            
+            CallRemote(players, name, args);
         }
         
         /// <summary>
@@ -246,10 +252,13 @@ namespace Onsharp.Utils
         /// <typeparam name="T">The type of the player</typeparam>
         public static void CallRemote<T>(this List<T> list, string name, params object[] args) where T : Player
         {
-            list.SafeForEach(player =>
+            int[] players = new int[list.Count];
+            for (int i = 0; i < players.Length; i++)
             {
-                player.CallRemote(name, args);
-            });
+                players[i] = list[i].Id;
+            }
+            
+            CallRemote(players, name, args);
         }
         
         /// <summary>
@@ -261,10 +270,64 @@ namespace Onsharp.Utils
         /// <typeparam name="T">The type of the player</typeparam>
         public static void CallRemote<T>(this Array list, string name, params object[] args) where T : Player
         {
-            list.SafeForEach<T>(player =>
+            int[] players = new int[list.Length];
+            for (int i = 0; i < players.Length; i++)
             {
-                player.CallRemote(name, args);
-            });
+                players[i] = ((T) list.GetValue(i)).Id;
+            }
+            
+            CallRemote(players, name, args);
+        }
+
+        /// <summary>
+        /// Groups the entities in this list by their dimension. The dimensions of all entities of the same type
+        /// are read at once from the native dimension index.
+        /// </summary>
+        /// <param name="list">The list containing the entities</param>
+        /// <typeparam name="T">The type of the entities</typeparam>
+        /// <returns>A dictionary containing the entities of every dimension</returns>
+        public static IReadOnlyDictionary<Dimension, List<T>> GroupByDimension<T>(this IReadOnlyList<T> list) where T : Entity
+        {
+            Dictionary<Dimension, List<T>> groups = new Dictionary<Dimension, List<T>>();
+            foreach (IGrouping<EntityType, T> entities in list.GroupBy(entity => entity.EntityType))
+            {
+                T[] group = entities.ToArray();
+                int[] ids = new int[group.Length];
+                for (int i = 0; i < group.Length; i++)
+                {
+                    ids[i] = group[i].Id;
+                }
+                
+                uint[] dimensions = new uint[group.Length];
+                Onset.GetEntityDimensions(entities.Key, ids, dimensions, ids.Length);
+                for (int i = 0; i < group.Length; i++)
+                {
+                    Dimension dimension = group[i].Owner.GetDimension(dimensions[i]);
+                    if (!groups.TryGetValue(dimension, out List<T> members))
+                    {
+                        members = new List<T>();
+                        groups.Add(dimension, members);
+                    }
+                    
+                    members.Add(group[i]);
+                }
+            }
+
+            return groups;
+        }
+
+        /// <summary>
+        /// Calls the remote event on all given players. The arguments are converted only once for all players.
+        /// </summary>
+        /// <param name="players">The ids of the receiving players</param>
+        /// <param name="name">The name of the remote event</param>
+        /// <param name="args">The arguments for the remote event</param>
+        private static void CallRemote(int[] players, string name, object[] args)
+        {
+            if(players.Length == 0) return;
+            IntPtr[] nVals = Bridge.CreateRemoteArgs(args);
+            Onset.CallRemoteMulticast(players, players.Length, name, nVals, nVals.Length);
+            Bridge.FreeNValues(args, nVals);
         }
 
         /// <summary>
@@ -310,5 +373,50 @@ namespace Onsharp.Utils
             });
             return b;
         }
+
+        /// <summary>
+        /// Reads the status of all given players in one call. The statuses are in the same order as the players.
+        /// </summary>
+        /// <param name="players">The players whose status is wanted</param>
+        /// <returns>The statuses of the players</returns>
+        public static PlayerStatus[] GetStatuses(this IReadOnlyList<Player> players)
+        {
+            int[] ids = new int[players.Count];
+            for (int i = 0; i < ids.Length; i++)
+                ids[i] = players[i].Id;
+            PlayerStatus[] statuses = new PlayerStatus[ids.Length];
+            Onset.GetPlayerStatuses(ids, statuses);
+            return statuses;
+        }
+
+        /// <summary>
+        /// Reads the status of all given vehicles in one call. The statuses are in the same order as the vehicles.
+        /// </summary>
+        /// <param name="vehicles">The vehicles whose status is wanted</param>
+        /// <returns>The statuses of the vehicles</returns>
+        public static VehicleStatus[] GetStatuses(this IReadOnlyList<Vehicle> vehicles)
+        {
+            int[] ids = new int[vehicles.Count];
+            for (int i = 0; i < ids.Length; i++)
+                ids[i] = vehicles[i].Id;
+            VehicleStatus[] statuses = new VehicleStatus[ids.Length];
+            Onset.GetVehicleStatuses(ids, statuses);
+            return statuses;
+        }
+
+        /// <summary>
+        /// Reads the status of all given NPCs in one call. The statuses are in the same order as the NPCs.
+        /// </summary>
+        /// <param name="npcs">The NPCs whose status is wanted</param>
+        /// <returns>The statuses of the NPCs</returns>
+        public static NPCStatus[] GetStatuses(this IReadOnlyList<NPC> npcs)
+        {
+            int[] ids = new int[npcs.Count];
+            for (int i = 0; i < ids.Length; i++)
+                ids[i] = npcs[i].Id;
+            NPCStatus[] statuses = new NPCStatus[ids.Length];
+            Onset.GetNPCStatuses(ids, statuses);
+            return statuses;
+        }
     }
-}
\ No newline at end of file
+}
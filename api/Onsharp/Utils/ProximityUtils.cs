@@ -0,0 +1,57 @@
+﻿using System;
+using Onsharp.Native;
+using Onsharp.World;
+
+namespace Onsharp.Utils
+{
+    /// <summary>
+    /// An utility class for proximity checks over many positions at once.
+    /// The positions are passed as separate arrays per axis and are checked by the native SIMD kernels.
+    /// </summary>
+    public static class ProximityUtils
+    {
+        /// <summary>
+        /// Checks which of the given positions are within the radius around the center.
+        /// </summary>
+        /// <param name="xs">The x axis values of the positions</param>
+        /// <param name="ys">The y axis values of the positions</param>
+        /// <param name="zs">The z axis values of the positions</param>
+        /// <param name="center">The center of the checked sphere</param>
+        /// <param name="radius">The radius of the checked sphere</param>
+        /// <param name="mask">The mask which gets 1 for every position within the radius and 0 otherwise</param>
+        /// <returns>The count of positions within the radius</returns>
+        public static int DistanceMask(float[] xs, float[] ys, float[] zs, Vector center, double radius, byte[] mask)
+        {
+            int count = GetCount(xs, ys, zs);
+            if (mask.Length < count)
+                throw new ArgumentException("The mask is smaller than the position arrays!");
+            return Onset.ComputeDistanceMask(xs, ys, zs, count, (float) center.X, (float) center.Y, (float) center.Z,
+                (float) radius, mask);
+        }
+
+        /// <summary>
+        /// Collects all pairs of positions which are within the radius of each other.
+        /// The first index of a pair is always lower than the second one.
+        /// </summary>
+        /// <param name="xs">The x axis values of the positions</param>
+        /// <param name="ys">The y axis values of the positions</param>
+        /// <param name="zs">The z axis values of the positions</param>
+        /// <param name="radius">The maximum distance between both positions of a pair</param>
+        /// <param name="first">The array which receives the first index of every pair</param>
+        /// <param name="second">The array which receives the second index of every pair</param>
+        /// <returns>The total count of pairs, which can be greater than the length of the receiving arrays</returns>
+        public static int PairsWithinRadius(float[] xs, float[] ys, float[] zs, double radius, int[] first, int[] second)
+        {
+            int count = GetCount(xs, ys, zs);
+            return Onset.ComputePairsWithinRadius(xs, ys, zs, count, (float) radius, first, second,
+                Math.Min(first.Length, second.Length));
+        }
+
+        private static int GetCount(float[] xs, float[] ys, float[] zs)
+        {
+            if (xs.Length != ys.Length || xs.Length != zs.Length)
+                throw new ArgumentException("The position arrays must have the same length!");
+            return xs.Length;
+        }
+    }
+}
@@ -1,4 +1,6 @@
 ﻿using System;
+using System.Collections.Generic;
+using System.Linq;
 using Onsharp.Entities;
 using Onsharp.Enums;
 using Onsharp.Native;
@@ -18,6 +20,54 @@ namespace Onsharp.World
             Value = value;
         }
 
+        /// <summary>
+        /// A list containing all players currently in this dimension.
+        /// </summary>
+        public IReadOnlyList<Player> Players => GetMembers(EntityType.Player, _server.CreatePlayer);
+
+        /// <summary>
+        /// A list containing all doors currently in this dimension.
+        /// </summary>
+        public IReadOnlyList<Door> Doors => GetMembers(EntityType.Door, _server.CreateDoor);
+
+        /// <summary>
+        /// A list containing all NPCs currently in this dimension.
+        /// </summary>
+        public IReadOnlyList<NPC> NPCs => GetMembers(EntityType.NPC, _server.CreateNPC);
+
+        /// <summary>
+        /// A list containing all objects currently in this dimension.
+        /// </summary>
+        public IReadOnlyList<Object> Objects => GetMembers(EntityType.Object, _server.CreateObject);
+
+        /// <summary>
+        /// A list containing all pickups currently in this dimension.
+        /// </summary>
+        public IReadOnlyList<Pickup> Pickups => GetMembers(EntityType.Pickup, _server.CreatePickup);
+
+        /// <summary>
+        /// A list containing all 3D texts currently in this dimension.
+        /// </summary>
+        public IReadOnlyList<Text3D> Text3Ds => GetMembers(EntityType.Text3D, _server.CreateText3D);
+
+        /// <summary>
+        /// A list containing all vehicles currently in this dimension.
+        /// </summary>
+        public IReadOnlyList<Vehicle> Vehicles => GetMembers(EntityType.Vehicle, _server.CreateVehicle);
+
+        /// <summary>
+        /// Calls a remote event handler on the client-side of every player in this dimension.
+        /// The arguments are converted only once for all players.
+        /// </summary>
+        /// <param name="name">The name of the remote event handler which should be called</param>
+        /// <param name="args">The arguments which will passed to the event handler. The maximum length is 14</param>
+        public void CallRemote(string name, params object[] args)
+        {
+            IntPtr[] nVals = Bridge.CreateRemoteArgs(args);
+            Onset.CallRemoteDimension(Value, name, nVals, nVals.Length);
+            Bridge.FreeNValues(args, nVals);
+        }
+
         /// <summary>
         /// Creates a vehicle in this dimension.
         /// </summary>
@@ -32,6 +82,20 @@ namespace Onsharp.World
             return vehicle;
         }
 
+        /// <summary>
+        /// Spawns the objects, pickups, 3D texts and doors of the given world layout file in this dimension.
+        /// The runtime spawns the layout in chunks over the next ticks and does not fire the created events
+        /// for these entities. 3D texts spawned from a layout do not know their text on the managed side.
+        /// </summary>
+        /// <param name="path">The path to the layout file written by <see cref="WorldLayout.Save"/></param>
+        /// <param name="onLoaded">The callback which gets the spawned entities in the order of the layout, entries which could not be spawned are null</param>
+        /// <param name="perTick">The maximum amount of entities spawned per tick</param>
+        /// <returns>False, if the file is no valid world layout</returns>
+        public bool LoadLayout(string path, Action<IReadOnlyList<Entity>> onLoaded = null, int perTick = 500)
+        {
+            return WorldLayout.Load(this, path, onLoaded, perTick);
+        }
+
         /// <summary>
         /// Creates a 3D text in this dimension.
         /// </summary>
@@ -129,6 +193,145 @@ namespace Onsharp.World
                 damageRadius);
         }
 
+        /// <summary>
+        /// Returns all entities of the given types in this dimension which are within the radius around the position.
+        /// The positions are taken from the native spatial index which is refreshed every tick.
+        /// </summary>
+        /// <param name="pos">The center of the searched sphere</param>
+        /// <param name="radius">The radius of the searched sphere</param>
+        /// <param name="types">The entity types which should be searched</param>
+        /// <returns>A list containing all found entities</returns>
+        public IReadOnlyList<Entity> GetEntitiesInRange(Vector pos, double radius, EntityTypes types = EntityTypes.All)
+        {
+            return QuerySpatial((ids, kinds, size) =>
+                Onset.QueryEntitiesInRadius(Value, pos.X, pos.Y, pos.Z, radius, (int) types, ids, kinds, size));
+        }
+
+        /// <summary>
+        /// Returns all players in this dimension which are within the radius around the position.
+        /// </summary>
+        /// <param name="pos">The center of the searched sphere</param>
+        /// <param name="radius">The radius of the searched sphere</param>
+        /// <returns>A list containing all found players</returns>
+        public IReadOnlyList<Player> GetPlayersInRange(Vector pos, double radius)
+        {
+            return GetEntitiesInRange(pos, radius, EntityTypes.Player).Cast<Player>().ToList().AsReadOnly();
+        }
+
+        /// <summary>
+        /// Returns all entities of the given types in this dimension which are inside of the box between both corners.
+        /// </summary>
+        /// <param name="min">The corner of the box with the lowest values on every axis</param>
+        /// <param name="max">The corner of the box with the highest values on every axis</param>
+        /// <param name="types">The entity types which should be searched</param>
+        /// <returns>A list containing all found entities</returns>
+        public IReadOnlyList<Entity> GetEntitiesInBox(Vector min, Vector max, EntityTypes types = EntityTypes.All)
+        {
+            return QuerySpatial((ids, kinds, size) =>
+                Onset.QueryEntitiesInBox(Value, min.X, min.Y, min.Z, max.X, max.Y, max.Z, (int) types, ids, kinds, size));
+        }
+
+        /// <summary>
+        /// Returns the nearest entities of the given types in this dimension ordered by their distance to the position.
+        /// </summary>
+        /// <param name="pos">The position from which the distance is measured</param>
+        /// <param name="count">The maximum count of returned entities</param>
+        /// <param name="types">The entity types which should be searched</param>
+        /// <returns>A list containing the nearest entities</returns>
+        public IReadOnlyList<Entity> GetNearestEntities(Vector pos, int count, EntityTypes types = EntityTypes.All)
+        {
+            int[] ids = new int[count];
+            int[] kinds = new int[count];
+            int found = Onset.QueryNearestEntities(Value, pos.X, pos.Y, pos.Z, (int) types, count, ids, kinds, null);
+            return CreateEntities(ids, kinds, found);
+        }
+
+        /// <summary>
+        /// Reads the members of the given entity type from the native dimension index and wraps them.
+        /// </summary>
+        private IReadOnlyList<T> GetMembers<T>(EntityType type, Func<int, T> creator) where T : Entity
+        {
+            int[] ids = new int[Onset.GetDimensionMembers(Value, type, null, 0)];
+            int count = Math.Min(Onset.GetDimensionMembers(Value, type, ids, ids.Length), ids.Length);
+            List<T> members = new List<T>(count);
+            for (int i = 0; i < count; i++)
+            {
+                members.Add(creator.Invoke(ids[i]));
+            }
+
+            return members.AsReadOnly();
+        }
+
+        /// <summary>
+        /// Runs the given spatial query and grows the buffers once if they were too small for all results.
+        /// </summary>
+        private IReadOnlyList<Entity> QuerySpatial(Func<int[], int[], int, int> query)
+        {
+            int size = 64;
+            int[] ids = new int[size];
+            int[] kinds = new int[size];
+            int found = query(ids, kinds, size);
+            if (found > size)
+            {
+                size = found;
+                ids = new int[size];
+                kinds = new int[size];
+                found = Math.Min(query(ids, kinds, size), size);
+            }
+
+            return CreateEntities(ids, kinds, found);
+        }
+
+        /// <summary>
+        /// Wraps the ids returned by a spatial query. The kinds are the native entity type ids.
+        /// </summary>
+        private IReadOnlyList<Entity> CreateEntities(int[] ids, int[] kinds, int count)
+        {
+            List<Entity> entities = new List<Entity>(count);
+            for (int i = 0; i < count; i++)
+            {
+                Entity entity = WrapEntity(ids[i], kinds[i]);
+                if (entity != null)
+                    entities.Add(entity);
+            }
+
+            return entities.AsReadOnly();
+        }
+
+        /// <summary>
+        /// Wraps the ids of a spawned world layout. The list keeps the order of the layout, entries which could
+        /// not be spawned are null.
+        /// </summary>
+        internal IReadOnlyList<Entity> WrapEntities(int[] ids, int[] types, int count)
+        {
+            Entity[] entities = new Entity[count];
+            for (int i = 0; i < count; i++)
+            {
+                if (ids[i] > 0)
+                    entities[i] = WrapEntity(ids[i], types[i]);
+            }
+
+            return Array.AsReadOnly(entities);
+        }
+
+        /// <summary>
+        /// Wraps the id of an entity of the given native entity type, null for an unknown type.
+        /// </summary>
+        private Entity WrapEntity(int id, int type)
+        {
+            return (EntityType) type switch
+            {
+                EntityType.Player => _server.CreatePlayer(id),
+                EntityType.Vehicle => _server.CreateVehicle(id),
+                EntityType.NPC => _server.CreateNPC(id),
+                EntityType.Object => _server.CreateObject(id),
+                EntityType.Pickup => _server.CreatePickup(id),
+                EntityType.Text3D => _server.CreateText3D(id),
+                EntityType.Door => _server.CreateDoor(id),
+                _ => null
+            };
+        }
+
         public bool Equals(Dimension other)
         {
             if (ReferenceEquals(null, other)) return false;
@@ -0,0 +1,194 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using Onsharp.Entities;
+using Onsharp.Native;
+
+namespace Onsharp.World
+{
+    /// <summary>
+    /// A world layout is a compact binary file of objects, pickups, 3D texts and doors which the native runtime
+    /// spawns in chunks over several ticks. Build the layout once with this class and load it with
+    /// <see cref="Dimension.LoadLayout"/> on every start instead of creating the entities one by one.
+    /// </summary>
+    public class WorldLayout
+    {
+        private const int Version = 1;
+        private const byte InteractFlag = 1;
+        private static readonly byte[] Magic = Encoding.ASCII.GetBytes("OWLF");
+        private static readonly Dictionary<int, (Dimension Dimension, Action<IReadOnlyList<Entity>> Callback)> PendingLoads =
+            new Dictionary<int, (Dimension, Action<IReadOnlyList<Entity>>)>();
+
+        private readonly List<Entry> _entries = new List<Entry>();
+
+        /// <summary>
+        /// The amount of entities in this layout.
+        /// </summary>
+        public int Count => _entries.Count;
+
+        /// <summary>
+        /// Adds an object to the layout.
+        /// </summary>
+        /// <param name="model">The model of the object</param>
+        /// <param name="pos">The position of the object</param>
+        /// <param name="rot">The rotation of the object</param>
+        /// <param name="scale">The scale of the object</param>
+        public void AddObject(int model, Vector pos, Vector rot = null, Vector scale = null)
+        {
+            _entries.Add(new Entry(EntityType.Object, model, pos, rot ?? Vector.Empty, scale ?? Vector.One));
+        }
+
+        /// <summary>
+        /// Adds a pickup to the layout.
+        /// </summary>
+        /// <param name="model">The model of the pickup</param>
+        /// <param name="pos">The position of the pickup</param>
+        public void AddPickup(int model, Vector pos)
+        {
+            _entries.Add(new Entry(EntityType.Pickup, model, pos, Vector.Empty, Vector.One));
+        }
+
+        /// <summary>
+        /// Adds a 3D text to the layout.
+        /// </summary>
+        /// <param name="text">The content of the 3D text</param>
+        /// <param name="size">The size of the 3D text</param>
+        /// <param name="pos">The position of the 3D text</param>
+        /// <param name="rot">The rotation of the 3D text</param>
+        public void AddText3D(string text, int size, Vector pos, Vector rot = null)
+        {
+            _entries.Add(new Entry(EntityType.Text3D, size, pos, rot ?? Vector.Empty, Vector.One) {Text = text});
+        }
+
+        /// <summary>
+        /// Adds a door to the layout.
+        /// </summary>
+        /// <param name="model">The model of the door</param>
+        /// <param name="pos">The position of the door</param>
+        /// <param name="yaw">The yaw of the door</param>
+        /// <param name="enableInteract">True enables the interaction with this door when pressing 'E'</param>
+        public void AddDoor(int model, Vector pos, double yaw, bool enableInteract = true)
+        {
+            _entries.Add(new Entry(EntityType.Door, model, pos, new Vector(0, yaw, 0), Vector.One)
+                {Flags = enableInteract ? InteractFlag : (byte) 0});
+        }
+
+        /// <summary>
+        /// Writes the layout to the given file.
+        /// </summary>
+        /// <param name="path">The path of the layout file</param>
+        public void Save(string path)
+        {
+            using MemoryStream texts = new MemoryStream();
+            uint[] offsets = new uint[_entries.Count];
+            ushort[] lengths = new ushort[_entries.Count];
+            for (int i = 0; i < _entries.Count; i++)
+            {
+                if (_entries[i].Text == null) continue;
+                byte[] bytes = Encoding.UTF8.GetBytes(_entries[i].Text);
+                if (bytes.Length > ushort.MaxValue)
+                    throw new ArgumentException($"The text of the 3D text #{i} is longer than {ushort.MaxValue} bytes!");
+                offsets[i] = (uint) texts.Length;
+                lengths[i] = (ushort) bytes.Length;
+                texts.Write(bytes, 0, bytes.Length);
+            }
+
+            using BinaryWriter writer = new BinaryWriter(File.Create(path));
+            writer.Write(Magic);
+            writer.Write((uint) Version);
+            writer.Write((uint) _entries.Count);
+            writer.Write((uint) texts.Length);
+            for (int i = 0; i < _entries.Count; i++)
+            {
+                Entry entry = _entries[i];
+                writer.Write((byte) entry.Type);
+                writer.Write(entry.Flags);
+                writer.Write(lengths[i]);
+                writer.Write(entry.Model);
+                writer.Write((float) entry.Position.X);
+                writer.Write((float) entry.Position.Y);
+                writer.Write((float) entry.Position.Z);
+                writer.Write((float) entry.Rotation.X);
+                writer.Write((float) entry.Rotation.Y);
+                writer.Write((float) entry.Rotation.Z);
+                writer.Write((float) entry.Scale.X);
+                writer.Write((float) entry.Scale.Y);
+                writer.Write((float) entry.Scale.Z);
+                writer.Write(offsets[i]);
+            }
+
+            texts.WriteTo(writer.BaseStream);
+        }
+
+        /// <summary>
+        /// Queues the layout file on the native side, which spawns it over the next ticks.
+        /// </summary>
+        internal static bool Load(Dimension dimension, string path, Action<IReadOnlyList<Entity>> callback, int perTick)
+        {
+            lock (PendingLoads)
+            {
+                int layout = Onset.LoadWorldLayout(path, dimension.Value, perTick);
+                if (layout <= 0)
+                    return false;
+                PendingLoads.Add(layout, (dimension, callback));
+                return true;
+            }
+        }
+
+        /// <summary>
+        /// Gets called by the native runtime when the layout with the given id is spawned completely.
+        /// </summary>
+        internal static void OnLoaded(int layout)
+        {
+            (Dimension Dimension, Action<IReadOnlyList<Entity>> Callback) load;
+            lock (PendingLoads)
+            {
+                if (!PendingLoads.Remove(layout, out load))
+                {
+                    Onset.ReleaseWorldLayout(layout);
+                    return;
+                }
+            }
+
+            int[] ids = new int[0];
+            int[] types = new int[0];
+            int count = Onset.GetWorldLayoutIds(layout, ids, types);
+            if (count > 0)
+            {
+                ids = new int[count];
+                types = new int[count];
+                Onset.GetWorldLayoutIds(layout, ids, types);
+            }
+
+            Onset.ReleaseWorldLayout(layout);
+            load.Callback?.Invoke(load.Dimension.WrapEntities(ids, types, Math.Max(count, 0)));
+        }
+
+        private class Entry
+        {
+            internal EntityType Type { get; }
+            
+            internal int Model { get; }
+            
+            internal Vector Position { get; }
+            
+            internal Vector Rotation { get; }
+            
+            internal Vector Scale { get; }
+
+            internal byte Flags { get; set; }
+
+            internal string Text { get; set; }
+
+            internal Entry(EntityType type, int model, Vector position, Vector rotation, Vector scale)
+            {
+                Type = type;
+                Model = model;
+                Position = position;
+                Rotation = rotation;
+                Scale = scale;
+            }
+        }
+    }
+}
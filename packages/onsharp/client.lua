@@ -0,0 +1,28 @@
+local handlers = {}
+local lastSequence = 0
+
+-- the events of a batch are only called on the handlers added here, other client packages add them through the export
+AddFunctionExport("AddRemoteEvent", function(name, handler)
+    handlers[name] = handlers[name] or {}
+    table.insert(handlers[name], handler)
+    return true
+end)
+
+-- every batch is acknowledged, a batch which is sent again or arrives out of order is not called twice. The server
+-- drops the batches before the oldest one it still keeps, so they are skipped.
+AddRemoteEvent("Onsharp_RemoteBatch", function(sequence, oldest, batch)
+    if oldest > lastSequence + 1 then
+        lastSequence = oldest - 1
+    end
+
+    if sequence == lastSequence + 1 then
+        lastSequence = sequence
+        for _, event in ipairs(batch) do
+            for _, handler in ipairs(handlers[event[1]] or {}) do
+                handler(table.unpack(event, 3, event[2] + 2))
+            end
+        end
+    end
+
+    CallRemoteEvent("Onsharp_RemoteBatchAck", lastSequence)
+end)
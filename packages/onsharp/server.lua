@@ -8,43 +8,18 @@ function Onsharp_ImportPackage(importId, packageName)
     importedPackages[importId] = ImportPackage(packageName)
 end
 
-function Onsharp_InvokePackage(importId, funcName, ...)
-    importedPackages[importId][funcName](...)
-end
-
-function Onsharp_RegisterCommand(pluginId, commandName)
-    AddCommand(commandName, function(playerId, ...)
-        local commandArgs = {...};
-        local line = "";
-        for _, v in ipairs(commandArgs) do
-            line = line .. " " .. tostring(v);
-        end
+function Onsharp_ResolvePackageFunction(importId, funcName)
+    local package = importedPackages[importId]
+    if package == nil then
+        return nil
+    end
 
-        local args = {};
-        args[1] = pluginId;
-        args[2] = playerId;
-        args[3] = commandName;
-        args[4] = line;
-		
-        CallBridge("call-command", args);
-    end)
+    return package[funcName]
 end
 
-function Onsharp_RegisterCommandAlias(pluginId, commandName, alias)
-    AddCommand(alias, function(playerId, ...)
-        local commandArgs = {...};
-        local line = "";
-        for _, v in ipairs(commandArgs) do
-            line = line .. " " .. tostring(v);
-        end
-
-        local args = {};
-        args[1] = pluginId;
-        args[2] = playerId;
-        args[3] = commandName;
-        args[4] = line;
-		
-        CallBridge("call-command", args);
+function Onsharp_RegisterCommand(handle, commandName)
+    AddCommand(commandName, function(playerId, ...)
+        CallCommand(handle, playerId, ...)
     end)
 end
 
@@ -65,6 +40,10 @@ function Onsharp_RegisterRemoteEvent(pluginId, eventName)
         CallBridge("call-remote", args);
     end)
 end
+AddRemoteEvent("Onsharp_RemoteBatchAck", function(playerId, sequence)
+    AcknowledgeRemoteBatch(playerId, sequence)
+end)
+
 function Onsharp_Delay(id, millis)
     Delay(millis, function ()
         local args = {}
@@ -81,6 +60,161 @@ function Onsharp_CreateTimer(id, interval)
     end, interval)
 end
 
+local function BoolToNumber(value)
+    if value then
+        return 1
+    end
+    return 0
+end
+
+-- the values { found, x, y, z, dimension } of every entity are appended in the order of the ids
+function Onsharp_GetEntityLocations(locationGetter, dimensionGetter, ids)
+    local getLocation = _G[locationGetter]
+    local getDimension = _G[dimensionGetter]
+    local values = {}
+    local idx = 0
+    for _, id in ipairs(ids) do
+        local x, y, z = getLocation(id)
+        if x then
+            values[idx + 1] = 1
+            values[idx + 2] = x
+            values[idx + 3] = y
+            values[idx + 4] = z
+            values[idx + 5] = getDimension(id) or 0
+        else
+            for i = 1, 5 do
+                values[idx + i] = 0
+            end
+        end
+        idx = idx + 5
+    end
+    return values
+end
+
+-- the values of every status are appended in the order the native status structs read them
+function Onsharp_GetPlayerStatuses(players)
+    local values = {}
+    local idx = 0
+    for _, player in ipairs(players) do
+        if IsValidPlayer(player) then
+            local x, y, z = GetPlayerLocation(player)
+            local status = { 1, x, y, z, GetPlayerHeading(player), GetPlayerHealth(player), GetPlayerArmor(player),
+                GetPlayerVehicle(player), GetPlayerVehicleSeat(player), GetPlayerPing(player), GetPlayerState(player),
+                GetPlayerMovementMode(player) }
+            for i = 1, 12 do
+                values[idx + i] = status[i] or 0
+            end
+        else
+            for i = 1, 12 do
+                values[idx + i] = 0
+            end
+        end
+        idx = idx + 12
+    end
+    return values
+end
+
+function Onsharp_GetVehicleStatuses(vehicles)
+    local values = {}
+    local idx = 0
+    for _, vehicle in ipairs(vehicles) do
+        if IsValidVehicle(vehicle) then
+            local x, y, z = GetVehicleLocation(vehicle)
+            local rx, ry, rz = GetVehicleRotation(vehicle)
+            local vx, vy, vz = GetVehicleVelocity(vehicle)
+            local status = { 1, x, y, z, rx, ry, rz, vx, vy, vz, GetVehicleHeading(vehicle), GetVehicleHealth(vehicle),
+                GetVehicleModel(vehicle), GetVehicleDriver(vehicle), BoolToNumber(GetVehicleEngineState(vehicle)),
+                GetVehicleGear(vehicle), BoolToNumber(GetVehicleLightEnabled(vehicle)) }
+            for i = 1, 17 do
+                values[idx + i] = status[i] or 0
+            end
+        else
+            for i = 1, 17 do
+                values[idx + i] = 0
+            end
+        end
+        idx = idx + 17
+    end
+    return values
+end
+
+function Onsharp_GetNPCStatuses(npcs)
+    local values = {}
+    local idx = 0
+    for _, npc in ipairs(npcs) do
+        if IsValidNPC(npc) then
+            local x, y, z = GetNPCLocation(npc)
+            local status = { 1, x, y, z, GetNPCHeading(npc), GetNPCHealth(npc) }
+            for i = 1, 6 do
+                values[idx + i] = status[i] or 0
+            end
+        else
+            for i = 1, 6 do
+                values[idx + i] = 0
+            end
+        end
+        idx = idx + 6
+    end
+    return values
+end
+
+-- the snapshot values are appended like the statuses, the license plates are returned as a second table
+function Onsharp_GetVehicleSnapshots(vehicles)
+    local values = {}
+    local plates = {}
+    local idx = 0
+    for n, vehicle in ipairs(vehicles) do
+        if IsValidVehicle(vehicle) then
+            local x, y, z = GetVehicleLocation(vehicle)
+            local rx, ry, rz = GetVehicleRotation(vehicle)
+            local snapshot = { 1, GetVehicleModel(vehicle), x, y, z, rx, ry, rz, GetVehicleHealth(vehicle),
+                GetVehicleColor(vehicle) }
+            for i = 1, 8 do
+                snapshot[10 + i] = GetVehicleDamage(vehicle, i)
+            end
+            for i = 1, 18 do
+                values[idx + i] = snapshot[i] or 0
+            end
+            plates[n] = GetVehicleLicensePlate(vehicle) or ""
+        else
+            for i = 1, 18 do
+                values[idx + i] = 0
+            end
+            plates[n] = ""
+        end
+        idx = idx + 18
+    end
+    return values, plates
+end
+
+function Onsharp_GetObjectSnapshots(objects)
+    local values = {}
+    local idx = 0
+    for _, object in ipairs(objects) do
+        if IsValidObject(object) then
+            local x, y, z = GetObjectLocation(object)
+            local rx, ry, rz = GetObjectRotation(object)
+            local sx, sy, sz = GetObjectScale(object)
+            local snapshot = { 1, GetObjectModel(object), x, y, z, rx, ry, rz, sx, sy, sz }
+            for i = 1, 11 do
+                values[idx + i] = snapshot[i] or 0
+            end
+        else
+            for i = 1, 11 do
+                values[idx + i] = 0
+            end
+        end
+        idx = idx + 11
+    end
+    return values
+end
+
+local createdEventsForwarded = true
+
+function Onsharp_SetCreatedEventsForwarded(forwarded)
+    createdEventsForwarded = forwarded
+end
+
 InitRuntimeEntries()
 
 local function CallBridgedEvent(eventType, ...)
@@ -125,7 +259,7 @@ AddEvent("OnPackageStop", function()
 end)
 
 AddEvent("OnGameTick", function(delta_)
-    return CallBridgedEvent(8, delta_)
+    CallGameTick(delta_)
 end)
 
 AddEvent("OnClientConnectionRequest", function(ip_, port_)
@@ -149,11 +283,11 @@ AddEvent("OnNPCDeath", function(npc_)
 end)
 
 AddEvent("OnNPCStreamIn", function(npc_, player_)
-    return CallBridgedEvent(14, player_, npc_)
+    CallStreamEvent(14, player_, npc_)
 end)
 
 AddEvent("OnNPCStreamOut", function(npc_, player_)
-    return CallBridgedEvent(15, player_, npc_)
+    CallStreamEvent(15, player_, npc_)
 end)
 
 AddEvent("OnPlayerEnterVehicle", function(player_, vehicle_, seat_)
@@ -193,11 +327,11 @@ AddEvent("OnPlayerDownloadFile", function(player_, file_, checksum_)
 end)
 
 AddEvent("OnPlayerStreamIn", function(player_, other_)
-    return CallBridgedEvent(25, player_, other_)
+    CallStreamEvent(25, player_, other_)
 end)
 
 AddEvent("OnPlayerStreamOut", function(player_, other_)
-    return CallBridgedEvent(26, player_, other_)
+    CallStreamEvent(26, player_, other_)
 end)
 
 AddEvent("OnPlayerSpawn", function(player_)
@@ -209,11 +343,11 @@ AddEvent("OnPlayerDeath", function(player_, killer_)
 end)
 
 AddEvent("OnPlayerWeaponShot", function(player_, weapon_, hittype_, hitid, hitX, hitY, hitZ, startX, startY, startZ, normalX, normalY, normalZ)
-    return CallBridgedEvent(29, player_, weapon_, hittype_, hitid, hitX, hitY, hitZ, startX, startY, startZ, normalX, normalY, normalZ)
+    return CallWeaponShot(player_, weapon_, hittype_, hitid, hitX, hitY, hitZ, startX, startY, startZ, normalX, normalY, normalZ)
 end)
 
 AddEvent("OnPlayerDamage", function(player_, type_, amount_)
-    return CallBridgedEvent(30, player_, type_, amount_)
+    return CallPlayerDamage(player_, type_, amount_)
 end)
 
 AddEvent("OnPlayerInteractDoor", function(player_, door_, bWantsOpen)
@@ -273,26 +407,44 @@ AddEvent("OnNPCChangeDimension", function(id, new_dim, old_dim)
 end)
 
 AddEvent("OnObjectCreated", function(id) 
+    if not createdEventsForwarded then
+        return
+    end
     return CallBridgedEvent(46, id)
 end)
 
 AddEvent("OnVehicleCreated", function(id) 
+    if not createdEventsForwarded then
+        return
+    end
     return CallBridgedEvent(47, id)
 end)
 
 AddEvent("OnText3DCreated", function(id) 
+    if not createdEventsForwarded then
+        return
+    end
     return CallBridgedEvent(48, id)
 end)
 
 AddEvent("OnPickupCreated", function(id) 
+    if not createdEventsForwarded then
+        return
+    end
     return CallBridgedEvent(49, id)
 end)
 
 AddEvent("OnNPCCreated", function(id) 
+    if not createdEventsForwarded then
+        return
+    end
     return CallBridgedEvent(50, id)
 end)
 
 AddEvent("OnDoorCreated", function(id) 
+    if not createdEventsForwarded then
+        return
+    end
     return CallBridgedEvent(51, id)
 end)
 
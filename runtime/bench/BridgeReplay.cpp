@@ -0,0 +1,295 @@
+//
+// Replays a recording of the bridge traffic against the runtime, see BridgeRecorder. With the managed runtime in the
+// working directory the bridge calls are replayed into it and it issues the native calls itself, without it the
+// recorded native calls are replayed directly. The exports which the managed runtime calls past the native api table
+// are not recorded, these are the trace and network statistics exports, the distance helpers, GetKeysFromTable and
+// GetNType. None of them changes the state of the server.
+//
+// Usage: OnsharpReplay <recording> [--speed <factor> | --max] [--package <server.lua>]
+//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include "StubServer.hpp"
+#include "BridgeRecorder.hpp"
+#include "MappedFile.hpp"
+#include "NativeApi.hpp"
+
+using NValue = Plugin::NValue;
+using NTYPE = Plugin::NTYPE;
+
+struct ReplayStats
+{
+    uint64_t count = 0;
+    double micros = 0;
+};
+
+static NValue* DecodeValue(BridgeReplay& replay)
+{
+    uint8_t type = 0;
+    if (!replay.Read(type))
+        return nullptr;
+
+    NValue* value = new NValue;
+    value->type = (NTYPE) type;
+    bool valid = true;
+    switch (value->type)
+    {
+        case NTYPE::STRING:
+        {
+            uint32_t length = 0;
+            valid = replay.Read(length);
+            const uint8_t* text = valid ? replay.ReadBuffer(length) : nullptr;
+            valid = text != nullptr;
+            if (valid)
+                value->sVal.assign((const char*) text, length);
+            break;
+        }
+        case NTYPE::DOUBLE:
+            valid = replay.Read(value->dVal);
+            break;
+        case NTYPE::INTEGER:
+        {
+            int32_t number = 0;
+            valid = replay.Read(number);
+            value->iVal = number;
+            break;
+        }
+        case NTYPE::BOOLEAN:
+        {
+            uint8_t flag = 0;
+            valid = replay.Read(flag);
+            value->bVal = flag != 0;
+            break;
+        }
+        case NTYPE::TABLE:
+            value->tVal = Lua::LuaTable_t(new Lua::LuaTable);
+            break;
+        default:
+            break;
+    }
+
+    if (valid)
+        return value;
+    delete value;
+    return nullptr;
+}
+
+int main(int argc, char** argv)
+{
+    const char* path = nullptr;
+    const char* packageScript = "packages/onsharp/server.lua";
+    double speed = 1.0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--max") == 0)
+            speed = 0;
+        else if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc)
+            speed = atof(argv[++i]);
+        else if (strcmp(argv[i], "--package") == 0 && i + 1 < argc)
+            packageScript = argv[++i];
+        else
+            path = argv[i];
+    }
+
+    if (path == nullptr)
+    {
+        printf("Usage: %s <recording> [--speed <factor> | --max] [--package <server.lua>]\n", argv[0]);
+        return 1;
+    }
+
+    MappedFile file;
+    if (!file.Open(path))
+    {
+        fprintf(stderr, "could not open the recording %s\n", path);
+        return 1;
+    }
+
+    BridgeReplay replay;
+    replay.Reset(file.GetData(), file.GetSize());
+    uint32_t version = 0, count = 0;
+    if (file.GetSize() < 4 || memcmp(file.GetData(), BRIDGE_RECORDING_MAGIC, 4) != 0)
+    {
+        fprintf(stderr, "%s is no bridge recording\n", path);
+        return 1;
+    }
+
+    replay.offset = 4;
+    if (!replay.Read(version) || version != BRIDGE_RECORDING_VERSION || !replay.Read(count))
+    {
+        fprintf(stderr, "the recording v%u does not match v%d\n", version, BRIDGE_RECORDING_VERSION);
+        return 1;
+    }
+
+    // the exports are matched by their name, so a recording stays replayable when the table grows
+    const NativeApi* api = GetNativeApi();
+    const char* const* names = GetNativeApiNames();
+    std::vector<int> indices(count, -1);
+    std::vector<std::string> recordedNames(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint16_t length = 0;
+        const uint8_t* name = replay.Read(length) ? replay.ReadBuffer(length) : nullptr;
+        if (name == nullptr)
+        {
+            fprintf(stderr, "the recording has a broken export table\n");
+            return 1;
+        }
+
+        recordedNames[i].assign((const char*) name, length);
+        for (int j = 0; j < api->count; j++)
+        {
+            if (recordedNames[i] == names[j])
+            {
+                indices[i] = j;
+                break;
+            }
+        }
+    }
+
+    StubServer server;
+    if (!server.Start(packageScript))
+        return 1;
+
+    printf("Replaying %s (%s, %s)\n", path, server.IsManaged() ? "managed" : "native",
+           speed > 0 ? "timed" : "as fast as possible");
+    printf("Not recorded: the trace and network statistics exports, the distance helpers, GetKeysFromTable and GetNType\n");
+
+    const BridgeReplayer_t* replayers = GetNativeApiReplayers();
+    std::map<std::string, ReplayStats> stats;
+    std::vector<std::pair<uint64_t, NValue*>> values;
+    uint64_t records = 0, skipped = 0;
+    size_t offset = replay.offset;
+    auto start = std::chrono::steady_clock::now();
+    while (file.GetSize() - offset >= sizeof(BridgeRecordHeader))
+    {
+        BridgeRecordHeader header;
+        memcpy(&header, file.GetData() + offset, sizeof(header));
+        offset += sizeof(header);
+        if (file.GetSize() - offset < header.size)
+            break;
+
+        replay.Reset(file.GetData() + offset, header.size);
+        offset += header.size;
+        records++;
+        if (speed > 0)
+            std::this_thread::sleep_until(start + std::chrono::nanoseconds((int64_t) (header.time / speed)));
+
+        std::string name;
+        bool replayed = true;
+        auto callStart = std::chrono::steady_clock::now();
+        switch ((BridgeRecordKind) header.kind)
+        {
+            case BridgeRecordKind::Tick:
+            {
+                float delta = 0;
+                replay.Read(delta);
+                // the values of the bridge calls are only referenced until the tick they were made in ends
+                for (const auto& [handle, value] : values)
+                {
+                    if (replay.FindHandle(handle) == value)
+                        replay.handles.erase(handle);
+                    delete value;
+                }
+                values.clear();
+                name = "tick";
+                callStart = std::chrono::steady_clock::now();
+                server.Tick(delta);
+                break;
+            }
+            case BridgeRecordKind::Call:
+            {
+                uint16_t keyLength = 0, length = 0;
+                const uint8_t* key = replay.Read(keyLength) ? replay.ReadBuffer(keyLength) : nullptr;
+                if (key == nullptr || !replay.Read(length))
+                {
+                    replayed = false;
+                    break;
+                }
+
+                std::vector<NValue*> args(length, nullptr);
+                for (uint16_t i = 0; i < length && replayed; i++)
+                {
+                    uint64_t handle = 0;
+                    replayed = replay.Read(handle) && (args[i] = DecodeValue(replay)) != nullptr;
+                    if (replayed)
+                    {
+                        replay.handles[handle] = args[i];
+                        values.emplace_back(handle, args[i]);
+                    }
+                }
+
+                // the key is not terminated in the recording
+                std::string bridgeKey((const char*) key, keyLength);
+                name = bridgeKey;
+                if (!replayed)
+                    break;
+
+                bool event = bridgeKey == "call-event" && length > 0 && args[0]->type == NTYPE::INTEGER;
+                if (event)
+                    name += ":" + std::to_string(args[0]->iVal);
+                callStart = std::chrono::steady_clock::now();
+                if (event)
+                    Plugin::Get()->ObserveEvent(args[0]->iVal, args.data(), length);
+                delete Plugin::Get()->CallBridge(bridgeKey.c_str(), (void**) args.data(), length);
+                if (event)
+                    Plugin::Get()->ObserveHandledEvent(args[0]->iVal, args.data(), length);
+                break;
+            }
+            case BridgeRecordKind::Export:
+            {
+                // the managed runtime issues the native calls itself
+                if (server.IsManaged())
+                    continue;
+
+                if (header.code >= count || indices[header.code] < 0)
+                {
+                    replayed = false;
+                    break;
+                }
+
+                name = recordedNames[header.code];
+                replayed = replayers[indices[header.code]](replay);
+                break;
+            }
+            default:
+                replayed = false;
+                break;
+        }
+
+        if (!replayed)
+        {
+            skipped++;
+            continue;
+        }
+
+        ReplayStats& entry = stats[name];
+        entry.count++;
+        entry.micros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - callStart).count();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (const auto& entry : values)
+        delete entry.second;
+    server.Stop();
+
+    printf("%llu records in %.2f s (%.0f records/s), %llu skipped\n", (unsigned long long) records, seconds,
+           records / std::max(seconds, 1e-9), (unsigned long long) skipped);
+
+    std::vector<std::pair<std::string, ReplayStats>> sorted(stats.begin(), stats.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.second.micros > b.second.micros; });
+    printf("  %-36s %10s %12s %10s\n", "call", "count", "total ms", "avg us");
+    for (size_t i = 0; i < sorted.size() && i < 25; i++)
+    {
+        const ReplayStats& entry = sorted[i].second;
+        printf("  %-36s %10llu %12.2f %10.2f\n", sorted[i].first.c_str(), (unsigned long long) entry.count,
+               entry.micros / 1000.0, entry.micros / entry.count);
+    }
+    return 0;
+}
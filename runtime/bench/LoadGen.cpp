@@ -0,0 +1,259 @@
+//
+// Drives the runtime with synthetic player traffic through the onsharp package, see StubServer. The players join,
+// chat, shoot, stream in and out of each other and call remote events and commands at the given rates per player and
+// second. The simulated time runs as fast as possible, the latencies are the wall time of each fired event. The
+// allocations are the ones of operator new, Lua allocates through its own allocator and is not counted.
+//
+// Usage: OnsharpLoadGen [--players <count>] [--seconds <simulated>] [--tick-rate <hz>] [--chat <rate>]
+//                       [--shots <rate>] [--streams <rate>] [--remotes <rate>] [--commands <rate>] [--package <path>]
+//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "StubServer.hpp"
+
+static std::atomic<uint64_t> Allocations{0};
+
+void* operator new(size_t size)
+{
+    Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+enum LoadKind
+{
+    Join,
+    Quit,
+    Chat,
+    Shot,
+    StreamIn,
+    StreamOut,
+    Remote,
+    Command,
+    Tick,
+    LoadKindCount
+};
+
+static const char* const LoadKindNames[] = {
+    "OnPlayerJoin", "OnPlayerQuit", "OnPlayerChat", "OnPlayerWeaponShot", "OnPlayerStreamIn", "OnPlayerStreamOut",
+    "remote event", "command", "tick"
+};
+
+struct LoadStats
+{
+    std::vector<double> micros;
+    uint64_t allocations = 0;
+};
+
+struct SimulatedPlayer
+{
+    int id;
+    int streamed = 0; // the player streamed in, zero if none
+    double chat = 0, shots = 0, streams = 0, remotes = 0, commands = 0;
+};
+
+static LoadStats Stats[LoadKindCount];
+
+template<typename Func>
+static void Measure(LoadKind kind, Func func)
+{
+    uint64_t allocations = Allocations.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    Stats[kind].micros.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    Stats[kind].allocations += Allocations.load(std::memory_order_relaxed) - allocations;
+}
+
+// the number of events due for the accumulated rate, the remainder is kept for the next tick
+static int Due(double& accumulator, double rate, double delta, std::mt19937& random)
+{
+    std::uniform_real_distribution<double> jitter(0.5, 1.5);
+    accumulator += rate * delta * jitter(random);
+    int due = (int) accumulator;
+    accumulator -= due;
+    return due;
+}
+
+static double Percentile(const std::vector<double>& sorted, double percentile)
+{
+    if (sorted.empty())
+        return 0;
+    size_t index = (size_t) (percentile / 100.0 * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+static void PrintUsage(const char* program)
+{
+    printf("Usage: %s [--players <count>] [--seconds <simulated>] [--tick-rate <hz>] [--chat <rate>] "
+           "[--shots <rate>] [--streams <rate>] [--remotes <rate>] [--commands <rate>] [--package <path>]\n",
+           program);
+}
+
+int main(int argc, char** argv)
+{
+    int players = 200;
+    double seconds = 30, tickRate = 30;
+    double chatRate = 0.2, shotRate = 4, streamRate = 1, remoteRate = 2, commandRate = 0.1;
+    const char* packageScript = "packages/onsharp/server.lua";
+    for (int i = 1; i < argc; i += 2)
+    {
+        const char* option = argv[i];
+        if (i + 1 == argc)
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+
+        const char* value = argv[i + 1];
+        if (strcmp(option, "--players") == 0)
+            players = atoi(value);
+        else if (strcmp(option, "--seconds") == 0)
+            seconds = atof(value);
+        else if (strcmp(option, "--tick-rate") == 0)
+            tickRate = atof(value);
+        else if (strcmp(option, "--chat") == 0)
+            chatRate = atof(value);
+        else if (strcmp(option, "--shots") == 0)
+            shotRate = atof(value);
+        else if (strcmp(option, "--streams") == 0)
+            streamRate = atof(value);
+        else if (strcmp(option, "--remotes") == 0)
+            remoteRate = atof(value);
+        else if (strcmp(option, "--commands") == 0)
+            commandRate = atof(value);
+        else if (strcmp(option, "--package") == 0)
+            packageScript = value;
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (players < 2 || seconds <= 0 || tickRate <= 0)
+    {
+        fprintf(stderr, "the load needs at least two players, a duration and a tick rate\n");
+        return 1;
+    }
+
+    StubServer server;
+    if (!server.Start(packageScript))
+        return 1;
+
+    // the remote event and the command are registered like a managed plugin does it
+    server.Call("Onsharp_RegisterRemoteEvent", "loadgen", "LoadGen_Ping");
+    server.Call("Onsharp_RegisterCommand", 1, "loadgen");
+    printf("Simulating %d players for %.0f s at %.0f ticks/s (%s)\n", players, seconds, tickRate,
+           server.IsManaged() ? "managed" : "native");
+
+    std::mt19937 random(1337);
+    std::uniform_int_distribution<int> pickPlayer(1, players);
+    std::uniform_real_distribution<double> coordinate(-200000.0, 200000.0);
+    std::vector<SimulatedPlayer> simulated;
+    simulated.reserve(players);
+    const double delta = 1.0 / tickRate;
+    const int ticks = (int) (seconds * tickRate);
+    // everyone joins within the first second
+    const int joinsPerTick = std::max(1, (int) std::ceil(players / tickRate));
+    std::string message = "loadgen chat message";
+    auto start = std::chrono::steady_clock::now();
+    uint64_t events = 0;
+    for (int tick = 0; tick < ticks; tick++)
+    {
+        for (int i = 0; i < joinsPerTick && (int) simulated.size() < players; i++)
+        {
+            SimulatedPlayer& player = simulated.emplace_back();
+            player.id = (int) simulated.size();
+            Measure(Join, [&]() { server.CallEvent("OnPlayerJoin", player.id); });
+            events++;
+        }
+
+        for (SimulatedPlayer& player : simulated)
+        {
+            for (int i = Due(player.chat, chatRate, delta, random); i > 0; i--, events++)
+                Measure(Chat, [&]() { server.CallEvent("OnPlayerChat", player.id, message); });
+
+            for (int i = Due(player.shots, shotRate, delta, random); i > 0; i--, events++)
+            {
+                int target = pickPlayer(random);
+                double x = coordinate(random), y = coordinate(random);
+                Measure(Shot, [&]() {
+                    server.CallEvent("OnPlayerWeaponShot", player.id, 5, 2, target, x, y, 100.0, x + 250.0, y - 250.0,
+                                     120.0, 0.0, 0.0, 1.0);
+                });
+            }
+
+            for (int i = Due(player.streams, streamRate, delta, random); i > 0; i--, events++)
+            {
+                if (player.streamed != 0)
+                {
+                    Measure(StreamOut, [&]() { server.CallEvent("OnPlayerStreamOut", player.id, player.streamed); });
+                    player.streamed = 0;
+                    continue;
+                }
+
+                player.streamed = pickPlayer(random);
+                Measure(StreamIn, [&]() { server.CallEvent("OnPlayerStreamIn", player.id, player.streamed); });
+            }
+
+            for (int i = Due(player.remotes, remoteRate, delta, random); i > 0; i--, events++)
+                Measure(Remote, [&]() { server.CallRemoteEvent(player.id, "LoadGen_Ping", tick, message); });
+
+            for (int i = Due(player.commands, commandRate, delta, random); i > 0; i--, events++)
+                Measure(Command, [&]() { server.CallCommand(player.id, "loadgen", "status", "all"); });
+        }
+
+        Measure(Tick, [&]() {
+            server.CallEvent("OnGameTick", delta);
+            server.Tick((float) delta);
+        });
+    }
+
+    for (const SimulatedPlayer& player : simulated)
+    {
+        Measure(Quit, [&]() { server.CallEvent("OnPlayerQuit", player.id); });
+        events++;
+    }
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    server.Stop();
+
+    printf("%llu events and %d ticks in %.2f s, %.0f events/s, %.1fx real time\n", (unsigned long long) events, ticks,
+           elapsed, events / elapsed, seconds / elapsed);
+    printf("  %-20s %10s %10s %10s %10s %10s %12s\n", "event", "count", "p50 us", "p90 us", "p99 us", "max us",
+           "allocs/call");
+    for (int kind = 0; kind < LoadKindCount; kind++)
+    {
+        std::vector<double>& micros = Stats[kind].micros;
+        if (micros.empty())
+            continue;
+
+        std::sort(micros.begin(), micros.end());
+        printf("  %-20s %10zu %10.2f %10.2f %10.2f %10.2f %12.1f\n", LoadKindNames[kind], micros.size(),
+               Percentile(micros, 50), Percentile(micros, 90), Percentile(micros, 99), micros.back(),
+               (double) Stats[kind].allocations / micros.size());
+    }
+    return 0;
+}
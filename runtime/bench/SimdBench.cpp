@@ -0,0 +1,101 @@
+//
+// Compares the SIMD distance kernels against the scalar fallback.
+//
+#include <cstdio>
+#include <cstdint>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstring>
+#include "SimdKernels.hpp"
+
+struct Positions
+{
+    std::vector<float> xs, ys, zs;
+
+    Positions(int count, std::mt19937& random)
+    {
+        std::uniform_real_distribution<float> plane(-200000.0f, 200000.0f);
+        std::uniform_real_distribution<float> height(0.0f, 5000.0f);
+        for (int i = 0; i < count; i++)
+        {
+            xs.push_back(plane(random));
+            ys.push_back(plane(random));
+            zs.push_back(height(random));
+        }
+    }
+};
+
+template<typename Func>
+static double Measure(int iterations, Func func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+static void BenchDistanceMask(const Positions& zones, int count, int iterations)
+{
+    std::vector<uint8_t> mask(count), expected(count);
+    Simd::SetLevel(Simd::Level::Scalar);
+    int expectedHits = Simd::DistanceMask(zones.xs.data(), zones.ys.data(), zones.zs.data(), count,
+                                          0, 0, 2500, 50000, expected.data());
+
+    printf("DistanceMask (%d positions, %d hits)\n", count, expectedHits);
+    double scalar = 0;
+    for (int level = 0; level <= (int) Simd::GetSupportedLevel(); level++)
+    {
+        Simd::SetLevel((Simd::Level) level);
+        int hits = 0;
+        double micros = Measure(iterations, [&]() {
+            hits = Simd::DistanceMask(zones.xs.data(), zones.ys.data(), zones.zs.data(), count,
+                                      0, 0, 2500, 50000, mask.data());
+        });
+        if (level == 0)
+            scalar = micros;
+        bool valid = hits == expectedHits && memcmp(mask.data(), expected.data(), mask.size()) == 0;
+        printf("  %-6s %10.2f us  %5.2fx  %s\n", Simd::GetLevelName(Simd::GetLevel()), micros, scalar / micros,
+               valid ? "ok" : "MISMATCH");
+    }
+}
+
+static void BenchPairs(const Positions& players, int count, int iterations)
+{
+    int maxPairs = count * 8;
+    std::vector<int> first(maxPairs), second(maxPairs);
+    Simd::SetLevel(Simd::Level::Scalar);
+    int expectedPairs = Simd::PairsWithinRadius(players.xs.data(), players.ys.data(), players.zs.data(), count,
+                                                10000, first.data(), second.data(), maxPairs);
+
+    printf("PairsWithinRadius (%d positions, %d pairs)\n", count, expectedPairs);
+    double scalar = 0;
+    for (int level = 0; level <= (int) Simd::GetSupportedLevel(); level++)
+    {
+        Simd::SetLevel((Simd::Level) level);
+        int pairs = 0;
+        double micros = Measure(iterations, [&]() {
+            pairs = Simd::PairsWithinRadius(players.xs.data(), players.ys.data(), players.zs.data(), count,
+                                            10000, first.data(), second.data(), maxPairs);
+        });
+        if (level == 0)
+            scalar = micros;
+        printf("  %-6s %10.2f us  %5.2fx  %s\n", Simd::GetLevelName(Simd::GetLevel()), micros, scalar / micros,
+               pairs == expectedPairs ? "ok" : "MISMATCH");
+    }
+}
+
+int main()
+{
+    std::mt19937 random(1337);
+    Positions zones(100000, random);
+    Positions players(1000, random);
+
+    printf("Supported level: %s\n", Simd::GetLevelName(Simd::GetSupportedLevel()));
+    BenchDistanceMask(zones, 1000, 20000);
+    BenchDistanceMask(zones, 100000, 200);
+    BenchPairs(players, 200, 2000);
+    BenchPairs(players, 1000, 100);
+    return 0;
+}
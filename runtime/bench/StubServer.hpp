@@ -0,0 +1,172 @@
+//
+// Hosts the runtime like the Onset server does, with a Lua state that stubs the server functions. Used by the tools
+// which drive the runtime without a server.
+//
+#pragma once
+#ifndef __STUB_SERVER_H__
+#define __STUB_SERVER_H__
+#include <cstdio>
+#include <string>
+#include <PluginSDK.h>
+#include "Plugin.hpp"
+
+EXPORT(int) OnPluginStart();
+EXPORT(void) OnPluginStop();
+EXPORT(void) OnPluginTick(float DeltaSeconds);
+EXPORT(void) OnPackageLoad(const char *PackageName, lua_State *L);
+EXPORT(void) OnPackageUnload(const char *PackageName);
+
+// Every unknown global is a function returning nothing, the GetAll functions return an empty table. The handlers of
+// the events, remote events and commands are kept so they can be called.
+static const char* StubServerScript = R"lua(
+local events = {}
+local remoteEvents = {}
+local commands = {}
+
+function AddEvent(name, handler)
+    events[name] = events[name] or {}
+    table.insert(events[name], handler)
+    return true
+end
+
+function AddRemoteEvent(name, handler)
+    remoteEvents[name] = handler
+    return true
+end
+
+function AddCommand(name, handler)
+    commands[name] = handler
+    return true
+end
+
+function CallEvent(name, ...)
+    local result = nil
+    for _, handler in ipairs(events[name] or {}) do
+        result = handler(...)
+    end
+    return result
+end
+
+function Stub_CallRemoteEvent(player, name, ...)
+    local handler = remoteEvents[name]
+    if handler ~= nil then
+        handler(player, ...)
+    end
+end
+
+function Stub_CallCommand(player, name, ...)
+    local handler = commands[name]
+    if handler ~= nil then
+        handler(player, ...)
+    end
+end
+
+function Delay() end
+function CreateTimer() return 0 end
+
+setmetatable(_G, {
+    __index = function(_, name)
+        if string.sub(name, 1, 6) == "GetAll" then
+            return function() return {} end
+        end
+        return function() return nil end
+    end
+})
+)lua";
+
+class StubServer
+{
+private:
+    lua_State* L = nullptr;
+    bool managed = false;
+
+    static void Push(lua_State* state, int value) { lua_pushinteger(state, value); }
+    static void Push(lua_State* state, double value) { lua_pushnumber(state, value); }
+    static void Push(lua_State* state, float value) { lua_pushnumber(state, value); }
+    static void Push(lua_State* state, bool value) { lua_pushboolean(state, value); }
+    static void Push(lua_State* state, const char* value) { lua_pushstring(state, value); }
+    static void Push(lua_State* state, const std::string& value) { lua_pushlstring(state, value.data(), value.size()); }
+
+    bool Run(int status, const char* what)
+    {
+        if (status == 0)
+            return true;
+
+        const char* error = lua_tostring(this->L, -1);
+        fprintf(stderr, "%s failed: %s\n", what, error != nullptr ? error : "unknown error");
+        lua_pop(this->L, 1);
+        return false;
+    }
+
+public:
+    // Starts the runtime and loads the onsharp package. The managed runtime is loaded from the working directory like
+    // on a server, without it the bridge calls of the package end in the runtime.
+    bool Start(const char* packageScript)
+    {
+        this->L = luaL_newstate();
+        luaL_openlibs(this->L);
+        if (!Run(luaL_dostring(this->L, StubServerScript), "the stub script"))
+            return false;
+
+        OnPluginStart();
+        OnPackageLoad("onsharp", this->L);
+        this->managed = Plugin::Get()->GetBridge().IsLoaded();
+        return Run(luaL_dofile(this->L, packageScript), packageScript);
+    }
+
+    void Stop()
+    {
+        if (this->L == nullptr)
+            return;
+
+        CallEvent("OnPackageStop");
+        OnPackageUnload("onsharp");
+        OnPluginStop();
+        lua_close(this->L);
+        this->L = nullptr;
+    }
+
+    bool IsManaged() const
+    {
+        return this->managed;
+    }
+
+    lua_State* GetState() const
+    {
+        return this->L;
+    }
+
+    void Tick(float delta)
+    {
+        OnPluginTick(delta);
+    }
+
+    // calls a global Lua function with the given arguments and drops its results
+    template<typename... A>
+    bool Call(const char* function, const A&... args)
+    {
+        lua_getglobal(this->L, function);
+        (Push(this->L, args), ...);
+        return Run(lua_pcall(this->L, (int) sizeof...(A), 0, 0), function);
+    }
+
+    template<typename... A>
+    bool CallEvent(const char* name, const A&... args)
+    {
+        return Call("CallEvent", name, args...);
+    }
+
+    template<typename... A>
+    bool CallRemoteEvent(int player, const char* name, const A&... args)
+    {
+        return Call("Stub_CallRemoteEvent", player, name, args...);
+    }
+
+    template<typename... A>
+    bool CallCommand(int player, const char* name, const A&... args)
+    {
+        return Call("Stub_CallCommand", player, name, args...);
+    }
+};
+
+#endif
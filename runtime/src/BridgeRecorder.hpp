@@ -0,0 +1,583 @@
+#pragma once
+#ifndef __BRIDGE_RECORDER_H__
+#define __BRIDGE_RECORDER_H__
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <string>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+#include <unordered_map>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include "Singleton.hpp"
+#include "LogRing.hpp"
+
+#define BRIDGE_RECORDING_MAGIC "OBRL"
+#define BRIDGE_RECORDING_VERSION 1
+#define BRIDGE_RECORDING_CHUNK (256 * 1024)
+#define BRIDGE_REPLAY_SCRATCH (4 * 1024 * 1024)
+#define BRIDGE_NULL_LENGTH 0xFFFFFFFFu
+
+enum class BridgeRecordKind : uint8_t
+{
+    Call = 0,
+    Export = 1,
+    Tick = 2
+};
+
+// A recording starts with the magic, the version and the names of the exports in table order, each one a uint16 length
+// and the name. Every record is this header followed by its payload, the time is in nanoseconds since the start.
+struct BridgeRecordHeader
+{
+    uint8_t kind;
+    uint8_t reserved;
+    uint16_t code; // the index of the export in the native api table
+    uint32_t size;
+    int64_t time;
+};
+
+static_assert(sizeof(BridgeRecordHeader) == 16, "the bridge record header has to stay 16 bytes");
+
+// pointers to these types are opaque handles. They are recorded by their address and mapped to the values created
+// while replaying
+template<typename T>
+struct IsBridgeHandle : std::false_type {};
+
+// Records every bridge call, every call of the native api and every server tick into a compact binary file. The
+// records are collected in chunks which a writer thread appends to the file. While no recording is running, the
+// bridge hook is one relaxed load and the native api table holds the plain exports.
+class BridgeRecorder : public Singleton<BridgeRecorder>
+{
+    friend class Singleton<BridgeRecorder>;
+private:
+    std::atomic<bool> recording{false};
+    std::chrono::steady_clock::time_point start;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::string chunk;
+    std::vector<std::string> full;
+    bool running = false;
+    std::thread writer;
+    FILE* file = nullptr;
+    uint64_t bytes = 0;
+    uint64_t appended = 0;
+    uint64_t limit = 0;
+
+    BridgeRecorder() = default;
+
+    ~BridgeRecorder()
+    {
+        Stop();
+    }
+
+    template<typename V>
+    static void Append(std::string& out, V value)
+    {
+        out.append((const char*) &value, sizeof(V));
+    }
+
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        while (true)
+        {
+            this->wake.wait(lock, [this] { return !this->running || !this->full.empty(); });
+            if (this->full.empty())
+                break;
+
+            std::vector<std::string> chunks = std::move(this->full);
+            this->full.clear();
+            lock.unlock();
+            for (const std::string& data : chunks)
+            {
+                if (fwrite(data.data(), 1, data.size(), this->file) != data.size())
+                    LogRing::Get()->Writef(LogLevel::Error, "Onsharp: could not write %zu bytes of the bridge recording", data.size());
+                this->bytes += data.size();
+            }
+            lock.lock();
+        }
+    }
+
+public:
+    template<typename Value>
+    static void EncodeValue(std::string& out, const Value& value)
+    {
+        using Type = decltype(value.type);
+        Append(out, (uint8_t) value.type);
+        switch (value.type)
+        {
+            case Type::STRING:
+                Append(out, (uint32_t) value.sVal.size());
+                out.append(value.sVal);
+                break;
+            case Type::DOUBLE:
+                Append(out, value.dVal);
+                break;
+            case Type::INTEGER:
+                Append(out, (int32_t) value.iVal);
+                break;
+            case Type::BOOLEAN:
+                Append(out, (uint8_t) value.bVal);
+                break;
+            default:
+                // tables are recorded without their content
+                break;
+        }
+    }
+
+    bool IsRecording() const
+    {
+        return this->recording.load(std::memory_order_relaxed);
+    }
+
+    int64_t Now() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->start).count();
+    }
+
+    // starts a recording into the given file which stops once the given count of bytes is recorded, zero records
+    // until it is stopped. Returns false if a recording is already running
+    bool Start(const std::string& path, const char* const* names, int count, uint64_t maxBytes)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->running)
+            return false;
+
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+        this->file = fopen(path.c_str(), "wb");
+        if (this->file == nullptr)
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: could not open the bridge recording %s", path.c_str());
+            return false;
+        }
+
+        this->chunk.clear();
+        this->chunk.append(BRIDGE_RECORDING_MAGIC, 4);
+        Append(this->chunk, (uint32_t) BRIDGE_RECORDING_VERSION);
+        Append(this->chunk, (uint32_t) count);
+        for (int i = 0; i < count; i++)
+        {
+            Append(this->chunk, (uint16_t) strlen(names[i]));
+            this->chunk.append(names[i]);
+        }
+
+        this->bytes = 0;
+        this->appended = this->chunk.size();
+        this->limit = maxBytes;
+        this->start = std::chrono::steady_clock::now();
+        this->running = true;
+        this->writer = std::thread(&BridgeRecorder::Run, this);
+        this->recording.store(true, std::memory_order_release);
+        LogRing::Get()->Writef(LogLevel::Info, "Onsharp: recording the bridge traffic to %s", path.c_str());
+        return true;
+    }
+
+    // stops the recording and waits until it is written, returns false if none was running
+    bool Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (!this->running)
+                return false;
+
+            this->recording.store(false);
+            this->full.push_back(std::move(this->chunk));
+            this->chunk = std::string();
+            this->running = false;
+        }
+        this->wake.notify_one();
+        this->writer.join();
+        fclose(this->file);
+        this->file = nullptr;
+        LogRing::Get()->Writef(LogLevel::Info, "Onsharp: bridge recording with %llu bytes written",
+                (unsigned long long) this->bytes);
+        return true;
+    }
+
+    // appends a finished record, called from any thread
+    void AppendRecord(BridgeRecordKind kind, uint16_t code, int64_t time, const std::string& payload)
+    {
+        BridgeRecordHeader header = { (uint8_t) kind, 0, code, (uint32_t) payload.size(), time };
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (!this->running)
+                return;
+
+            Append(this->chunk, header);
+            this->chunk.append(payload);
+            this->appended += sizeof(header) + payload.size();
+            if (this->limit == 0 || this->appended < this->limit)
+            {
+                if (this->chunk.size() < BRIDGE_RECORDING_CHUNK)
+                    return;
+
+                this->full.push_back(std::move(this->chunk));
+                this->chunk = std::string();
+                this->chunk.reserve(BRIDGE_RECORDING_CHUNK * 2);
+                this->wake.notify_one();
+                return;
+            }
+
+            LogRing::Get()->Writef(LogLevel::Warning, "Onsharp: the bridge recording reached its limit of %llu bytes",
+                    (unsigned long long) this->limit);
+        }
+        Stop();
+    }
+
+    template<typename Value>
+    void RecordCall(const char* key, Value* const* args, int len)
+    {
+        int64_t time = Now();
+        std::string payload;
+        size_t keyLength = strlen(key);
+        Append(payload, (uint16_t) keyLength);
+        payload.append(key, keyLength);
+        Append(payload, (uint16_t) len);
+        for (int i = 0; i < len; i++)
+        {
+            Append(payload, (uint64_t) (uintptr_t) args[i]);
+            EncodeValue(payload, *args[i]);
+        }
+        AppendRecord(BridgeRecordKind::Call, 0, time, payload);
+    }
+
+    void RecordTick(float delta)
+    {
+        std::string payload;
+        Append(payload, delta);
+        AppendRecord(BridgeRecordKind::Tick, 0, Now(), payload);
+    }
+};
+
+// The state of a replay. The handles of the recording are mapped to the ones created while replaying, the buffers keep
+// the decoded arguments of the current call alive.
+struct BridgeReplay
+{
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    size_t offset = 0;
+    std::unordered_map<uint64_t, void*> handles;
+    std::vector<std::vector<uint8_t>> buffers;
+    std::vector<std::pair<uint64_t, void**>> outputs;
+    std::vector<uint64_t> scratch;
+
+    BridgeReplay() : scratch(BRIDGE_REPLAY_SCRATCH / sizeof(uint64_t), 0) {}
+
+    void Reset(const uint8_t* payload, size_t length)
+    {
+        this->data = payload;
+        this->size = length;
+        this->offset = 0;
+        this->buffers.clear();
+        this->outputs.clear();
+    }
+
+    template<typename V>
+    bool Read(V& value)
+    {
+        if (this->size - this->offset < sizeof(V))
+            return false;
+        memcpy(&value, this->data + this->offset, sizeof(V));
+        this->offset += sizeof(V);
+        return true;
+    }
+
+    // copies the next bytes into a buffer which lives until the next record, the buffer ends with a zero
+    uint8_t* ReadBuffer(size_t length)
+    {
+        if (this->size - this->offset < length)
+            return nullptr;
+        std::vector<uint8_t>& buffer = this->buffers.emplace_back(length + 1, 0);
+        memcpy(buffer.data(), this->data + this->offset, length);
+        this->offset += length;
+        return buffer.data();
+    }
+
+    void* FindHandle(uint64_t handle) const
+    {
+        auto found = this->handles.find(handle);
+        return found == this->handles.end() ? nullptr : found->second;
+    }
+};
+
+// Records and replays the calls of one export. The arguments are encoded by their type: plain values as they are,
+// handles by their address, arrays of values or handles with the count of the first int argument after them, a char
+// pointer with the int right after it as its length or as a C string, and every other pointer as nothing, it points to
+// a scratch buffer when replayed. The record is written after the call, so output arrays hold their results.
+template<auto Function, int Index>
+struct RecordedExport;
+
+template<typename R, typename... A, R (*Function)(A...), int Index>
+struct RecordedExport<Function, Index>
+{
+private:
+    using Arguments_t = std::tuple<A...>;
+    static constexpr size_t Count = sizeof...(A);
+
+    template<typename T>
+    using Element_t = std::remove_cv_t<std::remove_pointer_t<T>>;
+
+    template<typename T>
+    static constexpr bool IsHandle = std::is_pointer_v<T> && IsBridgeHandle<Element_t<T>>::value;
+
+    template<typename T>
+    static constexpr bool IsHandleArray = std::is_pointer_v<T> && IsHandle<Element_t<T>>;
+
+    template<typename T>
+    static constexpr bool IsText = std::is_pointer_v<T> && std::is_same_v<Element_t<T>, char>;
+
+    template<typename T>
+    static constexpr bool IsArray = std::is_pointer_v<T> && std::is_arithmetic_v<Element_t<T>> && !IsText<T>;
+
+    // the index of the first int argument after the given one, Count if there is none
+    template<size_t I>
+    static constexpr size_t NextInt()
+    {
+        constexpr bool ints[] = { std::is_same_v<A, int>..., false };
+        for (size_t i = I + 1; i < Count; i++)
+        {
+            if (ints[i])
+                return i;
+        }
+        return Count;
+    }
+
+    template<size_t I>
+    static constexpr bool HasLength()
+    {
+        if constexpr (I + 1 < Count)
+            return std::is_same_v<std::tuple_element_t<I + 1, Arguments_t>, int>;
+        else
+            return false;
+    }
+
+    template<size_t I>
+    static uint32_t CountOf(const Arguments_t& args)
+    {
+        constexpr size_t next = NextInt<I>();
+        if constexpr (next < Count)
+            return std::get<next>(args) > 0 ? (uint32_t) std::get<next>(args) : 0;
+        else
+            return 0;
+    }
+
+    template<size_t I>
+    static void Encode(std::string& out, const Arguments_t& args)
+    {
+        using T = std::tuple_element_t<I, Arguments_t>;
+        const T& value = std::get<I>(args);
+        if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        {
+            out.append((const char*) &value, sizeof(T));
+        }
+        else if constexpr (IsHandle<T>)
+        {
+            uint64_t handle = (uint64_t) (uintptr_t) value;
+            out.append((const char*) &handle, sizeof(handle));
+        }
+        else if constexpr (IsHandleArray<T> || (IsArray<T> && NextInt<I>() < Count))
+        {
+            uint32_t count = value == nullptr ? BRIDGE_NULL_LENGTH : CountOf<I>(args);
+            out.append((const char*) &count, sizeof(count));
+            for (uint32_t i = 0; value != nullptr && i < count; i++)
+            {
+                if constexpr (IsHandleArray<T>)
+                {
+                    uint64_t handle = (uint64_t) (uintptr_t) value[i];
+                    out.append((const char*) &handle, sizeof(handle));
+                }
+                else
+                {
+                    out.append((const char*) &value[i], sizeof(Element_t<T>));
+                }
+            }
+        }
+        else if constexpr (IsText<T>)
+        {
+            uint32_t length = BRIDGE_NULL_LENGTH;
+            if constexpr (HasLength<I>())
+            {
+                if (value != nullptr)
+                    length = std::get<I + 1>(args) > 0 ? (uint32_t) std::get<I + 1>(args) : 0;
+            }
+            else
+            {
+                if (value != nullptr)
+                    length = (uint32_t) strlen(value);
+            }
+            out.append((const char*) &length, sizeof(length));
+            if (length != BRIDGE_NULL_LENGTH)
+                out.append(value, length);
+        }
+    }
+
+    template<size_t I>
+    static bool Decode(BridgeReplay& replay, Arguments_t& args)
+    {
+        using T = std::tuple_element_t<I, Arguments_t>;
+        T& value = std::get<I>(args);
+        if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        {
+            return replay.Read(value);
+        }
+        else if constexpr (IsHandle<T>)
+        {
+            uint64_t handle = 0;
+            if (!replay.Read(handle))
+                return false;
+            value = (T) replay.FindHandle(handle);
+            // a handle created outside of the recording cannot be replayed
+            return handle == 0 || value != nullptr;
+        }
+        else if constexpr (IsHandleArray<T> || (IsArray<T> && NextInt<I>() < Count))
+        {
+            uint32_t count = 0;
+            if (!replay.Read(count))
+                return false;
+            if (count == BRIDGE_NULL_LENGTH)
+            {
+                value = nullptr;
+                return true;
+            }
+
+            size_t size = sizeof(Element_t<T>) * count;
+            uint8_t* buffer = replay.ReadBuffer(IsHandleArray<T> ? sizeof(uint64_t) * count : size);
+            if (buffer == nullptr)
+                return false;
+
+            if constexpr (IsHandleArray<T>)
+            {
+                // unknown handles are outputs of the call, they are mapped once it returned
+                std::vector<uint8_t>& slots = replay.buffers.emplace_back(size + 1, 0);
+                auto pointers = (Element_t<T>*) slots.data();
+                for (uint32_t i = 0; i < count; i++)
+                {
+                    uint64_t handle = 0;
+                    memcpy(&handle, buffer + i * sizeof(uint64_t), sizeof(handle));
+                    pointers[i] = (Element_t<T>) replay.FindHandle(handle);
+                    if (pointers[i] == nullptr && handle != 0)
+                        replay.outputs.emplace_back(handle, (void**) &pointers[i]);
+                }
+                value = pointers;
+            }
+            else
+            {
+                value = (T) buffer;
+            }
+            return true;
+        }
+        else if constexpr (IsText<T>)
+        {
+            uint32_t length = 0;
+            if (!replay.Read(length))
+                return false;
+            if (length == BRIDGE_NULL_LENGTH)
+            {
+                value = nullptr;
+                return true;
+            }
+
+            value = (T) replay.ReadBuffer(length);
+            return value != nullptr;
+        }
+        else
+        {
+            value = (T) replay.scratch.data();
+            return true;
+        }
+    }
+
+    template<size_t... I>
+    static void EncodeAll(std::string& out, const Arguments_t& args, std::index_sequence<I...>)
+    {
+        (Encode<I>(out, args), ...);
+    }
+
+    template<size_t... I>
+    static bool DecodeAll(BridgeReplay& replay, Arguments_t& args, std::index_sequence<I...>)
+    {
+        return (Decode<I>(replay, args) && ...);
+    }
+
+    static void Record(int64_t time, const Arguments_t& args, const void* result)
+    {
+        std::string payload;
+        EncodeAll(payload, args, std::index_sequence_for<A...>{});
+        if constexpr (IsHandle<R>)
+        {
+            uint64_t handle = (uint64_t) (uintptr_t) *(const R*) result;
+            payload.append((const char*) &handle, sizeof(handle));
+        }
+        BridgeRecorder::Get()->AppendRecord(BridgeRecordKind::Export, (uint16_t) Index, time, payload);
+    }
+
+public:
+    static R Call(A... args)
+    {
+        // the recording table stays in use after the recording stopped
+        if (!BridgeRecorder::Get()->IsRecording())
+            return Function(args...);
+
+        int64_t time = BridgeRecorder::Get()->Now();
+        if constexpr (std::is_void_v<R>)
+        {
+            Function(args...);
+            Record(time, Arguments_t(args...), nullptr);
+        }
+        else
+        {
+            R result = Function(args...);
+            Record(time, Arguments_t(args...), &result);
+            return result;
+        }
+    }
+
+    // decodes the arguments of the current record and calls the export, false if the call could not be replayed
+    static bool Replay(BridgeReplay& replay)
+    {
+        Arguments_t args;
+        if (!DecodeAll(replay, args, std::index_sequence_for<A...>{}))
+            return false;
+
+        if constexpr (std::is_void_v<R>)
+        {
+            std::apply(Function, args);
+        }
+        else
+        {
+            R result = std::apply(Function, args);
+            if constexpr (IsHandle<R>)
+            {
+                uint64_t handle = 0;
+                if (replay.Read(handle) && handle != 0)
+                    replay.handles[handle] = (void*) result;
+            }
+            else
+            {
+                (void) result;
+            }
+        }
+
+        for (const auto& [handle, slot] : replay.outputs)
+        {
+            if (*slot != nullptr)
+                replay.handles[handle] = *slot;
+        }
+        return true;
+    }
+};
+
+using BridgeReplayer_t = bool (*)(BridgeReplay& replay);
+
+// the replayers of the native api in table order
+const BridgeReplayer_t* GetNativeApiReplayers();
+
+#endif
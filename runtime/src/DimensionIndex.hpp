@@ -0,0 +1,119 @@
+#pragma once
+#ifndef __DIMENSION_INDEX_H__
+#define __DIMENSION_INDEX_H__
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <PluginSDK.h>
+#include "Singleton.hpp"
+#include "EntityType.hpp"
+#include "EntityRegistry.hpp"
+
+class DimensionIndex : public Singleton<DimensionIndex>
+{
+    friend class Singleton<DimensionIndex>;
+private:
+    struct Membership
+    {
+        uint32_t dimension;
+        int32_t index;
+    };
+
+    using Members_t = std::vector<int>[(int) EntityType::Count];
+
+    std::unordered_map<uint32_t, Members_t> dimensions;
+    std::unordered_map<uint64_t, Membership> memberships;
+
+    DimensionIndex() = default;
+    ~DimensionIndex() = default;
+
+    static uint64_t MakeKey(EntityType type, int id)
+    {
+        return ((uint64_t) type << 32) | (uint32_t) id;
+    }
+
+    void Unlink(EntityType type, const Membership& membership)
+    {
+        auto dim = this->dimensions.find(membership.dimension);
+        if (dim == this->dimensions.end())
+            return;
+
+        std::vector<int>& members = dim->second[(int) type];
+        int last = members.back();
+        members[membership.index] = last;
+        this->memberships[MakeKey(type, last)].index = membership.index;
+        members.pop_back();
+    }
+
+public:
+    void Set(EntityType type, int id, uint32_t dimension)
+    {
+        if (type == EntityType::Count)
+            return;
+
+        uint64_t key = MakeKey(type, id);
+        auto it = this->memberships.find(key);
+        if (it != this->memberships.end())
+        {
+            if (it->second.dimension == dimension)
+                return;
+            Membership old = it->second;
+            Unlink(type, old);
+        }
+
+        std::vector<int>& members = this->dimensions[dimension][(int) type];
+        this->memberships[key] = { dimension, (int32_t) members.size() };
+        members.push_back(id);
+    }
+
+    void Remove(EntityType type, int id)
+    {
+        auto it = this->memberships.find(MakeKey(type, id));
+        if (it == this->memberships.end())
+            return;
+
+        Membership old = it->second;
+        Unlink(type, old);
+        this->memberships.erase(MakeKey(type, id));
+    }
+
+    bool TryGet(EntityType type, int id, uint32_t& dimension) const
+    {
+        auto it = this->memberships.find(MakeKey(type, id));
+        if (it == this->memberships.end())
+            return false;
+
+        dimension = it->second.dimension;
+        return true;
+    }
+
+    const std::vector<int>* GetMembers(uint32_t dimension, EntityType type) const
+    {
+        auto dim = this->dimensions.find(dimension);
+        if (dim == this->dimensions.end() || type == EntityType::Count)
+            return nullptr;
+        return &dim->second[(int) type];
+    }
+
+    // asks Lua once for the dimension of every registered entity
+    void Seed(lua_State* L)
+    {
+        static constexpr const char* getters[(int) EntityType::Count] = ENTITY_NAME_TABLE(GetDimension);
+
+        int top = lua_gettop(L);
+        for (int type = 0; type < (int) EntityType::Count; type++)
+        {
+            for (int id : EntityRegistry::Get()->GetIds((EntityType) type))
+            {
+                lua_getglobal(L, getters[type]);
+                lua_pushinteger(L, id);
+                if (lua_pcall(L, 1, 1, 0) == LUA_OK)
+                    Set((EntityType) type, id, (uint32_t) lua_tointeger(L, -1));
+                lua_settop(L, top);
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,131 @@
+#pragma once
+#ifndef __ENTITY_FUNCTIONS_H__
+#define __ENTITY_FUNCTIONS_H__
+#include "EntityType.hpp"
+#include "Plugin.hpp"
+#include "PropertyStore.hpp"
+#include "EntityRegistry.hpp"
+#include "DimensionIndex.hpp"
+#include "SpatialIndex.hpp"
+
+// The generic entity functions, instantiated once per entity type. The Lua function names come from the EntityTraits,
+// so the exports only pick the instantiation by the entity type and never build a function name at runtime.
+namespace EntityFunctions
+{
+    template<EntityType T>
+    Plugin::NValue* GetPropertyValue(int id, const char* key)
+    {
+        const Plugin::NValue* value = PropertyStore::Get()->Find(T, id, key);
+        if (value != nullptr)
+            return new Plugin::NValue(*value);
+
+        Lua::LuaArgs_t args = Lua::BuildArgumentList(id, key);
+        Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction(EntityTraits<T>::GetPropertyValue, &args);
+        return Plugin::Get()->CreateNValueByLua(returnValues.at(0));
+    }
+
+    template<EntityType T>
+    void SetPropertyValue(int id, const char* key, Plugin::NValue* value, bool sync)
+    {
+        // a synced value is owned by the Lua property system, so writes of the Lua packages are not shadowed by a copy
+        if (!sync)
+        {
+            PropertyStore::Get()->Set(T, id, key, *value);
+            return;
+        }
+
+        PropertyStore::Get()->Remove(T, id, key);
+        Lua::LuaArgs_t args = Lua::BuildArgumentList(id, key);
+        value->AddAsArg(&args);
+        args.emplace_back(sync);
+        Plugin::Get()->CallLuaFunction(EntityTraits<T>::SetPropertyValue, &args);
+    }
+
+    template<EntityType T>
+    void GetPosition(int id, double* x, double* y, double* z)
+    {
+        lua_State* L = Plugin::Get()->GetMainState();
+        if (!Plugin::Get()->CallLuaDirect(EntityTraits<T>::GetLocation, 3, id))
+        {
+            *x = *y = *z = 0;
+            return;
+        }
+
+        *x = lua_tonumber(L, -3);
+        *y = lua_tonumber(L, -2);
+        *z = lua_tonumber(L, -1);
+        lua_pop(L, 3);
+    }
+
+    template<EntityType T>
+    void SetPosition(int id, double x, double y, double z)
+    {
+        Plugin::Get()->CallLuaDirect(EntityTraits<T>::SetLocation, 0, id, x, y, z);
+        SpatialIndex::Get()->UpdatePosition(T, id, x, y, z);
+    }
+
+    template<EntityType T>
+    uint32_t GetDimension(int id)
+    {
+        uint32_t dimension = 0;
+        if (DimensionIndex::Get()->TryGet(T, id, dimension))
+            return dimension;
+
+        lua_State* L = Plugin::Get()->GetMainState();
+        if (!Plugin::Get()->CallLuaDirect(EntityTraits<T>::GetDimension, 1, id))
+            return 0;
+
+        dimension = (uint32_t) lua_tointeger(L, -1);
+        lua_pop(L, 1);
+        return dimension;
+    }
+
+    template<EntityType T>
+    void SetDimension(int id, uint32_t dimension)
+    {
+        Plugin::Get()->CallLuaDirect(EntityTraits<T>::SetDimension, 0, id, dimension);
+        if (EntityRegistry::Get()->IsValid(T, id))
+            Plugin::Get()->SetEntityDimension(T, id, dimension);
+    }
+
+    template<EntityType T>
+    void Destroy(int id)
+    {
+        Plugin::Get()->CallLuaDirect(EntityTraits<T>::Destroy, 0, id);
+        Plugin::Get()->OnEntityDestroyed(T, id);
+    }
+
+    template<EntityType T>
+    bool IsValid(int id)
+    {
+        // Onset has no destroyed event for vehicles, so a vehicle destroyed by a Lua package is still registered
+        if (!EntityRegistry::Get()->IsValid(T, id))
+            return false;
+        if constexpr (T != EntityType::Vehicle)
+            return true;
+
+        lua_State* L = Plugin::Get()->GetMainState();
+        if (!Plugin::Get()->CallLuaDirect(EntityTraits<T>::IsValid, 1, id))
+            return false;
+
+        bool valid = lua_toboolean(L, -1) != 0;
+        lua_pop(L, 1);
+        if (!valid)
+            Plugin::Get()->OnEntityDestroyed(T, id);
+        return valid;
+    }
+
+    template<EntityType T>
+    bool IsStreamedIn(int player, int id)
+    {
+        lua_State* L = Plugin::Get()->GetMainState();
+        if (!Plugin::Get()->CallLuaDirect(EntityTraits<T>::IsStreamedIn, 1, player, id))
+            return false;
+
+        bool streamed = lua_toboolean(L, -1) != 0;
+        lua_pop(L, 1);
+        return streamed;
+    }
+}
+
+#endif
@@ -0,0 +1,133 @@
+#pragma once
+#ifndef __ENTITY_REGISTRY_H__
+#define __ENTITY_REGISTRY_H__
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <PluginSDK.h>
+#include "Singleton.hpp"
+#include "EntityType.hpp"
+
+class EntityRegistry : public Singleton<EntityRegistry>
+{
+    friend class Singleton<EntityRegistry>;
+private:
+    struct Slot
+    {
+        uint32_t generation = 0;
+        int32_t dense = -1;
+    };
+
+    // the sparse slots are indexed by the entity id, the dense ids are kept packed for enumeration
+    struct Table
+    {
+        std::vector<Slot> sparse;
+        std::vector<int> dense;
+    };
+
+    Table tables[(int) EntityType::Count];
+
+    EntityRegistry() = default;
+    ~EntityRegistry() = default;
+
+public:
+    void Add(EntityType type, int id)
+    {
+        if (type == EntityType::Count || id < 0)
+            return;
+
+        Table& table = this->tables[(int) type];
+        if ((size_t) id >= table.sparse.size())
+            table.sparse.resize((size_t) id + 1);
+
+        Slot& slot = table.sparse[id];
+        if (slot.dense >= 0)
+            return;
+
+        slot.generation++;
+        slot.dense = (int32_t) table.dense.size();
+        table.dense.push_back(id);
+    }
+
+    void Remove(EntityType type, int id)
+    {
+        if (!IsValid(type, id))
+            return;
+
+        Table& table = this->tables[(int) type];
+        Slot& slot = table.sparse[id];
+        int last = table.dense.back();
+        table.dense[slot.dense] = last;
+        table.sparse[last].dense = slot.dense;
+        table.dense.pop_back();
+        slot.dense = -1;
+    }
+
+    bool IsValid(EntityType type, int id) const
+    {
+        if (type == EntityType::Count || id < 0)
+            return false;
+
+        const Table& table = this->tables[(int) type];
+        return (size_t) id < table.sparse.size() && table.sparse[id].dense >= 0;
+    }
+
+    // the generation changes every time an id is reused, so stale handles can be told apart
+    uint32_t GetGeneration(EntityType type, int id) const
+    {
+        if (type == EntityType::Count || id < 0)
+            return 0;
+
+        const Table& table = this->tables[(int) type];
+        return (size_t) id < table.sparse.size() ? table.sparse[id].generation : 0;
+    }
+
+    const std::vector<int>& GetIds(EntityType type) const
+    {
+        return this->tables[(int) type].dense;
+    }
+
+    int Count(EntityType type) const
+    {
+        return type == EntityType::Count ? 0 : (int) this->tables[(int) type].dense.size();
+    }
+
+    // copies as many ids as fit into the buffer and returns the total count
+    int Enumerate(EntityType type, int* buffer, int size) const
+    {
+        if (type == EntityType::Count)
+            return 0;
+
+        const std::vector<int>& dense = this->tables[(int) type].dense;
+        int count = (int) dense.size();
+        if (buffer != nullptr && size > 0)
+            memcpy(buffer, dense.data(), sizeof(int) * (size_t) (size < count ? size : count));
+        return count;
+    }
+
+    void Seed(lua_State* L)
+    {
+        static const char* getters[(int) EntityType::Count] = {
+                "GetAllPlayers", "GetAllVehicles", "GetAllNPC", "GetAllObjects",
+                "GetAllPickups", "GetAllText3D", "GetAllDoors"
+        };
+
+        int top = lua_gettop(L);
+        for (int type = 0; type < (int) EntityType::Count; type++)
+        {
+            lua_getglobal(L, getters[type]);
+            if (lua_pcall(L, 0, 1, 0) == LUA_OK && lua_istable(L, -1))
+            {
+                lua_pushnil(L);
+                while (lua_next(L, -2) != 0)
+                {
+                    Add((EntityType) type, (int) lua_tointeger(L, -1));
+                    lua_pop(L, 1);
+                }
+            }
+            lua_settop(L, top);
+        }
+    }
+};
+
+#endif
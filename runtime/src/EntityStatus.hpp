@@ -0,0 +1,63 @@
+#pragma once
+#ifndef __ENTITY_STATUS_H__
+#define __ENTITY_STATUS_H__
+#include <cstdint>
+
+// The commonly read fields of the entities, filled in one call each. The layouts are shared with the managed structs of
+// the same name, so the doubles come first and the structs have no implicit padding. The lua helpers Onsharp_Get*Statuses
+// return the values in the order of the *_STATUS_FIELDS comments.
+
+// valid, x, y, z, heading, health, armor, vehicle, seat, ping, state, movementMode
+#define PLAYER_STATUS_FIELDS 12
+struct PlayerStatus
+{
+    double x, y, z;
+    double heading;
+    double health;
+    double armor;
+    int32_t id;
+    int32_t valid;
+    int32_t vehicle;
+    int32_t seat;
+    int32_t ping;
+    int32_t state;
+    int32_t movementMode;
+    uint32_t dimension;
+};
+static_assert(sizeof(PlayerStatus) == 80, "PlayerStatus has to match the managed layout");
+
+// valid, x, y, z, rx, ry, rz, vx, vy, vz, heading, health, model, driver, engine, gear, light
+#define VEHICLE_STATUS_FIELDS 17
+struct VehicleStatus
+{
+    double x, y, z;
+    double rx, ry, rz;
+    double vx, vy, vz;
+    double heading;
+    double health;
+    int32_t id;
+    int32_t valid;
+    int32_t model;
+    int32_t driver;
+    int32_t engine;
+    int32_t gear;
+    int32_t light;
+    uint32_t dimension;
+};
+static_assert(sizeof(VehicleStatus) == 120, "VehicleStatus has to match the managed layout");
+
+// valid, x, y, z, heading, health
+#define NPC_STATUS_FIELDS 6
+struct NPCStatus
+{
+    double x, y, z;
+    double heading;
+    double health;
+    int32_t id;
+    int32_t valid;
+    uint32_t dimension;
+    int32_t reserved;
+};
+static_assert(sizeof(NPCStatus) == 56, "NPCStatus has to match the managed layout");
+
+#endif
@@ -0,0 +1,62 @@
+#pragma once
+#ifndef __ENTITY_TYPE_H__
+#define __ENTITY_TYPE_H__
+
+enum class EntityType
+{
+    Player = 0,
+    Vehicle = 1,
+    NPC = 2,
+    Object = 3,
+    Pickup = 4,
+    Text3D = 5,
+    Door = 6,
+    Count = 7
+};
+
+// the Lua functions of an entity type. The names are string literals, so every call site gets a constant name and no
+// string is built per call
+template<EntityType T>
+struct EntityTraits;
+
+#define ENTITY_TRAITS(T) \
+    template<> \
+    struct EntityTraits<EntityType::T> \
+    { \
+        static constexpr const char* Name = #T; \
+        static constexpr const char* GetLocation = "Get" #T "Location"; \
+        static constexpr const char* SetLocation = "Set" #T "Location"; \
+        static constexpr const char* GetDimension = "Get" #T "Dimension"; \
+        static constexpr const char* SetDimension = "Set" #T "Dimension"; \
+        static constexpr const char* GetPropertyValue = "Get" #T "PropertyValue"; \
+        static constexpr const char* SetPropertyValue = "Set" #T "PropertyValue"; \
+        static constexpr const char* Destroy = "Destroy" #T; \
+        static constexpr const char* IsValid = "IsValid" #T; \
+        static constexpr const char* IsStreamedIn = "Is" #T "StreamedIn"; \
+    };
+
+ENTITY_TRAITS(Player)
+ENTITY_TRAITS(Vehicle)
+ENTITY_TRAITS(NPC)
+ENTITY_TRAITS(Object)
+ENTITY_TRAITS(Pickup)
+ENTITY_TRAITS(Text3D)
+ENTITY_TRAITS(Door)
+
+#undef ENTITY_TRAITS
+
+// one instantiation of the function template F per entity type, indexable by the entity type
+#define ENTITY_TYPE_TABLE(F) { &F<EntityType::Player>, &F<EntityType::Vehicle>, &F<EntityType::NPC>, \
+    &F<EntityType::Object>, &F<EntityType::Pickup>, &F<EntityType::Text3D>, &F<EntityType::Door> }
+
+// one function name of the traits per entity type, for code which only knows the entity type at runtime
+#define ENTITY_NAME_TABLE(M) { EntityTraits<EntityType::Player>::M, EntityTraits<EntityType::Vehicle>::M, \
+    EntityTraits<EntityType::NPC>::M, EntityTraits<EntityType::Object>::M, EntityTraits<EntityType::Pickup>::M, \
+    EntityTraits<EntityType::Text3D>::M, EntityTraits<EntityType::Door>::M }
+
+inline bool IsEntityType(int type)
+{
+    return type >= 0 && type < (int) EntityType::Count;
+}
+
+#endif
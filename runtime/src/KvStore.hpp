@@ -0,0 +1,566 @@
+#pragma once
+#ifndef __KV_STORE_H__
+#define __KV_STORE_H__
+#include <array>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <unordered_map>
+#include "Singleton.hpp"
+#include "MappedFile.hpp"
+#include "LogRing.hpp"
+
+#ifdef _WIN32
+#include <io.h>
+#endif
+
+#define KV_STORE_MAGIC "OKVS"
+#define KV_STORE_VERSION 1
+#define KV_FILE_HEADER 8
+#define KV_TOMBSTONE 0xFFFFFFFFu
+#define KV_COMPACT_MIN_DEAD (1024 * 1024)
+#define KV_RETRY_DELAY 1000
+
+// A crash safe key value store. Every change is appended to the log file as a record guarded by a CRC32, an in-memory
+// index points to the latest value of every key and the values are read from a read only mapping of the log. Writes
+// are queued and committed in groups by a writer thread, which also compacts the log once most of it is dead.
+// On open the log is scanned and cut at the first broken record, so a crash loses at most the uncommitted writes.
+// A batch which could not be committed is queued again and retried, until the store is closed.
+class KvStore
+{
+private:
+    struct RecordHeader
+    {
+        uint32_t crc;
+        uint32_t keyLength;
+        uint32_t valueLength;
+    };
+
+    struct Location
+    {
+        uint64_t offset; // of the value
+        uint32_t length;
+    };
+
+    struct Pending
+    {
+        std::string key;
+        std::string value;
+        bool removed;
+        uint64_t sequence;
+    };
+
+    struct PendingValue
+    {
+        std::string value;
+        bool removed;
+        uint64_t sequence;
+    };
+
+    std::string path;
+    FILE* log = nullptr;
+    uint64_t logSize = 0;
+    MappedFile map;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable committed;
+    std::unordered_map<std::string, Location> index;
+    std::unordered_map<std::string, PendingValue> pending;
+    std::vector<Pending> queue;
+    uint64_t nextSequence = 1;
+    uint64_t committedSequence = 0;
+    uint64_t failures = 0;
+    size_t lost = 0;
+    uint64_t liveBytes = 0;
+    uint64_t deadBytes = 0;
+    bool running = false;
+    std::thread writer;
+
+    static uint32_t RecordCrc(const RecordHeader& header, const char* key, const char* value)
+    {
+        uint32_t crc = Crc32(0, &header.keyLength, sizeof(uint32_t) * 2);
+        crc = Crc32(crc, key, header.keyLength);
+        if (header.valueLength != KV_TOMBSTONE)
+            crc = Crc32(crc, value, header.valueLength);
+        return crc;
+    }
+
+    static uint64_t RecordSize(size_t keyLength, size_t valueLength)
+    {
+        return sizeof(RecordHeader) + keyLength + valueLength;
+    }
+
+    static void AppendRecord(std::string& buffer, const std::string& key, const char* value, uint32_t valueLength)
+    {
+        RecordHeader header;
+        header.keyLength = (uint32_t) key.size();
+        header.valueLength = valueLength;
+        header.crc = RecordCrc(header, key.data(), value);
+        buffer.append((const char*) &header, sizeof(header));
+        buffer.append(key);
+        if (valueLength != KV_TOMBSTONE)
+            buffer.append(value, valueLength);
+    }
+
+    // reads the whole log into the index and returns the size of its valid part, -1 if the file is no store
+    int64_t Scan()
+    {
+        MappedFile file;
+        if (!file.Open(this->path) || file.GetSize() < KV_FILE_HEADER)
+            return 0;
+
+        const uint8_t* data = file.GetData();
+        uint64_t size = file.GetSize();
+        if (memcmp(data, KV_STORE_MAGIC, 4) != 0)
+            return -1;
+
+        uint64_t offset = KV_FILE_HEADER;
+        while (offset + sizeof(RecordHeader) <= size)
+        {
+            RecordHeader header;
+            memcpy(&header, data + offset, sizeof(header));
+            uint64_t valueLength = header.valueLength == KV_TOMBSTONE ? 0 : header.valueLength;
+            uint64_t end = offset + sizeof(RecordHeader) + header.keyLength + valueLength;
+            if (end > size)
+                break;
+
+            const char* key = (const char*) data + offset + sizeof(RecordHeader);
+            if (RecordCrc(header, key, key + header.keyLength) != header.crc)
+                break;
+
+            std::string name(key, header.keyLength);
+            auto existing = this->index.find(name);
+            if (existing != this->index.end())
+            {
+                this->deadBytes += RecordSize(name.size(), existing->second.length);
+                this->liveBytes -= RecordSize(name.size(), existing->second.length);
+            }
+
+            if (header.valueLength == KV_TOMBSTONE)
+            {
+                if (existing != this->index.end())
+                    this->index.erase(existing);
+                this->deadBytes += RecordSize(name.size(), 0);
+            }
+            else
+            {
+                this->index[name] = { offset + sizeof(RecordHeader) + header.keyLength, header.valueLength };
+                this->liveBytes += RecordSize(name.size(), header.valueLength);
+            }
+            offset = end;
+        }
+        return (int64_t) offset;
+    }
+
+    bool OpenLog(uint64_t validSize)
+    {
+        std::error_code error;
+        if (validSize < KV_FILE_HEADER)
+        {
+            this->log = fopen(this->path.c_str(), "wb");
+            if (this->log == nullptr)
+                return false;
+
+            uint32_t version = KV_STORE_VERSION;
+            fwrite(KV_STORE_MAGIC, 1, 4, this->log);
+            fwrite(&version, sizeof(version), 1, this->log);
+            SyncFile(this->log);
+            fclose(this->log);
+            validSize = KV_FILE_HEADER;
+        }
+        else if (std::filesystem::file_size(this->path, error) > validSize)
+        {
+            LogRing::Get()->Writef(LogLevel::Warning, "Onsharp: cutting the broken tail of key value store %s",
+                    this->path.c_str());
+            std::filesystem::resize_file(this->path, validSize, error);
+        }
+
+        this->log = fopen(this->path.c_str(), "ab");
+        this->logSize = validSize;
+        return this->log != nullptr;
+    }
+
+    // cuts a partially written batch off, records behind it would be lost when the log is scanned the next time
+    void Truncate()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->map.Close();
+        if (this->log != nullptr)
+            fclose(this->log);
+        std::error_code error;
+        std::filesystem::resize_file(this->path, this->logSize, error);
+        this->log = fopen(this->path.c_str(), "ab");
+    }
+
+    // rewrites the log with only the live values. Runs on the writer thread, which is the only one appending
+    void Compact()
+    {
+        std::vector<std::pair<std::string, Location>> live;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            live.assign(this->index.begin(), this->index.end());
+        }
+
+        MappedFile source;
+        if (!source.Open(this->path))
+            return;
+
+        std::string target = this->path + ".compact";
+        FILE* out = fopen(target.c_str(), "wb");
+        if (out == nullptr)
+            return;
+
+        uint32_t version = KV_STORE_VERSION;
+        fwrite(KV_STORE_MAGIC, 1, 4, out);
+        fwrite(&version, sizeof(version), 1, out);
+        uint64_t offset = KV_FILE_HEADER;
+        std::string buffer;
+        std::unordered_map<std::string, Location> moved;
+        moved.reserve(live.size());
+        for (const auto& entry : live)
+        {
+            const char* value = (const char*) source.GetData() + entry.second.offset;
+            buffer.clear();
+            AppendRecord(buffer, entry.first, value, entry.second.length);
+            fwrite(buffer.data(), 1, buffer.size(), out);
+            moved[entry.first] = { offset + sizeof(RecordHeader) + entry.first.size(), entry.second.length };
+            offset += buffer.size();
+        }
+
+        bool ok = SyncFile(out);
+        fclose(out);
+        source.Close();
+        if (!ok)
+            return;
+
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->map.Close();
+        if (this->log != nullptr)
+            fclose(this->log);
+        std::error_code error;
+        std::filesystem::rename(target, this->path, error);
+        if (!error)
+        {
+            this->index = std::move(moved);
+            this->liveBytes = offset - KV_FILE_HEADER;
+            this->deadBytes = 0;
+        }
+        this->log = fopen(this->path.c_str(), "ab");
+        this->logSize = std::filesystem::file_size(this->path, error);
+    }
+
+    void Write()
+    {
+        std::vector<Pending> batch;
+        std::string buffer;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(this->mutex);
+                this->wake.wait(lock, [this] { return !this->running || !this->queue.empty(); });
+                if (this->queue.empty())
+                    return;
+                batch.swap(this->queue);
+            }
+
+            buffer.clear();
+            std::vector<uint64_t> offsets;
+            offsets.reserve(batch.size());
+            uint64_t offset = this->logSize;
+            for (const Pending& entry : batch)
+            {
+                size_t start = buffer.size();
+                AppendRecord(buffer, entry.key, entry.value.data(), entry.removed ? KV_TOMBSTONE : (uint32_t) entry.value.size());
+                offsets.push_back(offset + start + sizeof(RecordHeader) + entry.key.size());
+            }
+
+            bool ok = this->log != nullptr && fwrite(buffer.data(), 1, buffer.size(), this->log) == buffer.size() &&
+                    SyncFile(this->log);
+            if (!ok)
+            {
+                // the values stay readable from the pending writes, the batch goes back in front of the newer writes
+                LogRing::Get()->Writef(LogLevel::Error, "Onsharp: could not commit %d writes to key value store %s",
+                        (int) batch.size(), this->path.c_str());
+                Truncate();
+                std::unique_lock<std::mutex> lock(this->mutex);
+                this->failures++;
+                this->committed.notify_all();
+                if (!this->running)
+                {
+                    this->lost = batch.size() + this->queue.size();
+                    return;
+                }
+
+                batch.insert(batch.end(), std::make_move_iterator(this->queue.begin()),
+                        std::make_move_iterator(this->queue.end()));
+                this->queue.swap(batch);
+                batch.clear();
+                this->wake.wait_for(lock, std::chrono::milliseconds(KV_RETRY_DELAY), [this] { return !this->running; });
+                continue;
+            }
+
+            bool compact = false;
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->logSize += buffer.size();
+                for (size_t i = 0; i < batch.size(); i++)
+                {
+                    const Pending& entry = batch[i];
+                    auto existing = this->index.find(entry.key);
+                    if (existing != this->index.end())
+                    {
+                        this->deadBytes += RecordSize(entry.key.size(), existing->second.length);
+                        this->liveBytes -= RecordSize(entry.key.size(), existing->second.length);
+                    }
+
+                    if (entry.removed)
+                    {
+                        if (existing != this->index.end())
+                            this->index.erase(existing);
+                        this->deadBytes += RecordSize(entry.key.size(), 0);
+                    }
+                    else
+                    {
+                        this->index[entry.key] = { offsets[i], (uint32_t) entry.value.size() };
+                        this->liveBytes += RecordSize(entry.key.size(), entry.value.size());
+                    }
+
+                    // a newer write of the key is still queued, it stays pending until it is committed itself
+                    auto waiting = this->pending.find(entry.key);
+                    if (waiting != this->pending.end() && waiting->second.sequence == entry.sequence)
+                        this->pending.erase(waiting);
+                }
+                this->committedSequence = batch.back().sequence;
+                compact = this->deadBytes >= KV_COMPACT_MIN_DEAD && this->deadBytes > this->liveBytes;
+            }
+            this->committed.notify_all();
+            batch.clear();
+
+            if (compact)
+                Compact();
+        }
+    }
+
+public:
+    static uint32_t Crc32(uint32_t crc, const void* data, size_t length)
+    {
+        static const std::array<uint32_t, 256> table = [] {
+            std::array<uint32_t, 256> values{};
+            for (uint32_t i = 0; i < 256; i++)
+            {
+                uint32_t c = i;
+                for (int k = 0; k < 8; k++)
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                values[i] = c;
+            }
+            return values;
+        }();
+
+        const auto* bytes = (const uint8_t*) data;
+        crc = ~crc;
+        for (size_t i = 0; i < length; i++)
+            crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    static bool SyncFile(FILE* file)
+    {
+        if (fflush(file) != 0)
+            return false;
+#ifdef _WIN32
+        return _commit(_fileno(file)) == 0;
+#else
+        return fsync(fileno(file)) == 0;
+#endif
+    }
+
+    ~KvStore()
+    {
+        Close();
+    }
+
+    bool Open(const std::string& file)
+    {
+        this->path = file;
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(file).parent_path(), error);
+        int64_t validSize = Scan();
+        if (validSize < 0 || !OpenLog((uint64_t) validSize))
+            return false;
+
+        this->running = true;
+        this->writer = std::thread(&KvStore::Write, this);
+        return true;
+    }
+
+    // commits the pending writes and closes the log, returns false if writes were lost
+    bool Close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (!this->running)
+                return this->lost == 0;
+            this->running = false;
+        }
+        this->wake.notify_all();
+        if (this->writer.joinable())
+            this->writer.join();
+        this->map.Close();
+        if (this->log != nullptr)
+            fclose(this->log);
+        this->log = nullptr;
+        if (this->lost == 0)
+            return true;
+
+        LogRing::Get()->Writef(LogLevel::Error, "Onsharp: %d writes to key value store %s were lost on close",
+                (int) this->lost, this->path.c_str());
+        return false;
+    }
+
+    // queues the write, a write to a closed store is rejected and counted as lost
+    void Put(const char* key, int keyLength, const char* value, int valueLength, bool removed)
+    {
+        std::string name(key, keyLength > 0 ? (size_t) keyLength : 0);
+        std::string data;
+        if (!removed)
+            data.assign(value, valueLength > 0 ? (size_t) valueLength : 0);
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (!this->running)
+            {
+                this->lost++;
+                LogRing::Get()->Writef(LogLevel::Error, "Onsharp: write to the closed key value store %s was lost",
+                        this->path.c_str());
+                return;
+            }
+
+            uint64_t sequence = this->nextSequence++;
+            this->pending[name] = { data, removed, sequence };
+            this->queue.push_back({ std::move(name), std::move(data), removed, sequence });
+        }
+        this->wake.notify_one();
+    }
+
+    // copies the value into the buffer, returns its length or -1 if the key is not stored
+    int Get(const char* key, int keyLength, char* buffer, int size)
+    {
+        std::string name(key, keyLength > 0 ? (size_t) keyLength : 0);
+        std::lock_guard<std::mutex> lock(this->mutex);
+        auto waiting = this->pending.find(name);
+        if (waiting != this->pending.end())
+        {
+            if (waiting->second.removed)
+                return -1;
+
+            int length = (int) waiting->second.value.size();
+            if (buffer != nullptr && size >= length)
+                memcpy(buffer, waiting->second.value.data(), (size_t) length);
+            return length;
+        }
+
+        auto entry = this->index.find(name);
+        if (entry == this->index.end())
+            return -1;
+
+        int length = (int) entry->second.length;
+        if (buffer == nullptr || size < length)
+            return length;
+
+        if (entry->second.offset + entry->second.length > this->map.GetSize() && !this->map.Open(this->path))
+            return -1;
+
+        memcpy(buffer, this->map.GetData() + entry->second.offset, (size_t) length);
+        return length;
+    }
+
+    // blocks until every write queued so far is committed to the disk, returns false if a commit failed meanwhile
+    bool Flush()
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        uint64_t target = this->nextSequence - 1;
+        uint64_t failures = this->failures;
+        this->committed.wait(lock, [this, target, failures] {
+            return !this->running || this->committedSequence >= target || this->failures != failures;
+        });
+        return this->committedSequence >= target;
+    }
+
+    int Count()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        int count = (int) this->index.size();
+        for (const auto& entry : this->pending)
+        {
+            bool stored = this->index.find(entry.first) != this->index.end();
+            if (entry.second.removed && stored)
+                count--;
+            else if (!entry.second.removed && !stored)
+                count++;
+        }
+        return count;
+    }
+};
+
+// The open key value stores by their handles. The stores are shared, so a store which is closed while another thread
+// still uses it stays valid for that call, but a write of it which comes after the close is rejected and logged.
+class KvStoreRegistry : public Singleton<KvStoreRegistry>
+{
+    friend class Singleton<KvStoreRegistry>;
+private:
+    std::mutex mutex;
+    std::unordered_map<int, std::shared_ptr<KvStore>> stores;
+    int nextHandle = 1;
+
+    KvStoreRegistry() = default;
+    ~KvStoreRegistry() = default;
+
+public:
+    int Open(const std::string& path)
+    {
+        auto store = std::make_shared<KvStore>();
+        if (!store->Open(path))
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: could not open key value store %s", path.c_str());
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> lock(this->mutex);
+        int handle = this->nextHandle++;
+        this->stores[handle] = std::move(store);
+        return handle;
+    }
+
+    std::shared_ptr<KvStore> Find(int handle)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        auto store = this->stores.find(handle);
+        return store == this->stores.end() ? nullptr : store->second;
+    }
+
+    // returns false if writes were lost
+    bool Close(int handle)
+    {
+        std::shared_ptr<KvStore> store;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            auto found = this->stores.find(handle);
+            if (found == this->stores.end())
+                return true;
+            store = std::move(found->second);
+            this->stores.erase(found);
+        }
+        return store->Close();
+    }
+};
+
+#endif
@@ -0,0 +1,353 @@
+#pragma once
+#ifndef __LOG_RING_H__
+#define __LOG_RING_H__
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstdarg>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <unordered_map>
+#include <PluginSDK.h>
+#include "Singleton.hpp"
+
+#define LOG_RING_CAPACITY 4096
+#define LOG_SLOT_TEXT 232
+#define LOG_MAX_SLOTS 64
+#define LOG_FLUSH_TIMEOUT 500
+
+// matches the serilog event levels of the managed loggers
+enum class LogLevel : uint8_t
+{
+    Verbose = 0,
+    Debug = 1,
+    Info = 2,
+    Warning = 3,
+    Error = 4,
+    Fatal = 5
+};
+
+// A bounded multi producer, single consumer ring. A record spans up to LOG_MAX_SLOTS consecutive slots which are
+// reserved at once, every slot is published on its own through its sequence number.
+class LogRing : public Singleton<LogRing>
+{
+    friend class Singleton<LogRing>;
+private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        int64_t time;
+        uint16_t sink;
+        uint16_t length;
+        uint8_t level;
+        uint8_t slots;
+        bool toConsole;
+        char text[LOG_SLOT_TEXT];
+    };
+
+    struct SinkFile
+    {
+        FILE* file = nullptr;
+        std::string date;
+    };
+
+    Slot* slots;
+    std::atomic<size_t> enqueuePos{0};
+    size_t dequeuePos = 0;
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> running{false};
+    std::thread drainer;
+
+    std::mutex sinkMutex;
+    std::vector<std::string> sinks;
+    std::unordered_map<uint16_t, SinkFile> files;
+
+    LogRing()
+    {
+        this->slots = new Slot[LOG_RING_CAPACITY];
+        for (size_t i = 0; i < LOG_RING_CAPACITY; i++)
+            this->slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    ~LogRing()
+    {
+        Stop();
+        delete[] this->slots;
+    }
+
+    static const char* GetLevelTag(uint8_t level)
+    {
+        switch ((LogLevel) level)
+        {
+            case LogLevel::Verbose: return "VRB";
+            case LogLevel::Debug: return "DBG";
+            case LogLevel::Warning: return "WRN";
+            case LogLevel::Error: return "ERR";
+            case LogLevel::Fatal: return "FTL";
+            default: return "INF";
+        }
+    }
+
+    FILE* GetSinkFile(uint16_t sink, const tm& local)
+    {
+        char date[16];
+        strftime(date, sizeof(date), "%d_%m_%Y", &local);
+        SinkFile& sinkFile = this->files[sink];
+        if (sinkFile.file != nullptr && sinkFile.date == date)
+            return sinkFile.file;
+
+        if (sinkFile.file != nullptr)
+            fclose(sinkFile.file);
+
+        std::string directory;
+        {
+            std::lock_guard<std::mutex> lock(this->sinkMutex);
+            if (sink < this->sinks.size())
+                directory = this->sinks[sink];
+        }
+
+        sinkFile.date = date;
+        sinkFile.file = nullptr;
+        if (!directory.empty())
+        {
+            std::error_code error;
+            std::filesystem::create_directories(directory, error);
+            sinkFile.file = fopen((std::filesystem::path(directory) / (sinkFile.date + ".txt")).string().c_str(), "a");
+        }
+        return sinkFile.file;
+    }
+
+    // the tools host the runtime without a server, their console is stdout
+    static void ToConsole(const char* text, size_t length)
+    {
+        if (Onset::Plugin::Get() != nullptr)
+        {
+            Onset::Plugin::Get()->Log("%.*s", (int) length, text);
+            return;
+        }
+        fwrite(text, 1, length, stdout);
+        fputc('\n', stdout);
+    }
+
+    // takes one complete record out of the ring, returns false if no record is published yet
+    bool Drain(std::string& text)
+    {
+        Slot& head = this->slots[this->dequeuePos & (LOG_RING_CAPACITY - 1)];
+        if (head.sequence.load(std::memory_order_acquire) != this->dequeuePos + 1)
+            return false;
+
+        int64_t time = head.time;
+        uint16_t sink = head.sink;
+        uint8_t level = head.level;
+        bool toConsole = head.toConsole;
+        int count = head.slots;
+        text.clear();
+        for (int i = 0; i < count; i++)
+        {
+            Slot& slot = this->slots[this->dequeuePos & (LOG_RING_CAPACITY - 1)];
+            while (slot.sequence.load(std::memory_order_acquire) != this->dequeuePos + 1)
+                std::this_thread::yield();
+            text.append(slot.text, slot.length);
+            slot.sequence.store(this->dequeuePos + LOG_RING_CAPACITY, std::memory_order_release);
+            this->dequeuePos++;
+        }
+
+        if (toConsole)
+            ToConsole(text.c_str(), text.size());
+
+        time_t raw = (time_t) time;
+        tm local{};
+#ifdef _WIN32
+        localtime_s(&local, &raw);
+#else
+        localtime_r(&raw, &local);
+#endif
+        FILE* file = GetSinkFile(sink, local);
+        if (file != nullptr)
+        {
+            char stamp[16];
+            strftime(stamp, sizeof(stamp), "%I:%M:%S", &local);
+            fprintf(file, "[%s %s] %s\n", stamp, GetLevelTag(level), text.c_str());
+        }
+        return true;
+    }
+
+    // the records which are published but not drained, the slots a writer claimed and did not publish yet are no record
+    size_t CountPublished() const
+    {
+        size_t records = 0;
+        size_t pos = this->dequeuePos;
+        size_t end = this->enqueuePos.load(std::memory_order_acquire);
+        while (pos < end)
+        {
+            const Slot& head = this->slots[pos & (LOG_RING_CAPACITY - 1)];
+            if (head.sequence.load(std::memory_order_acquire) != pos + 1)
+                break;
+
+            records++;
+            pos += head.slots;
+        }
+        return records;
+    }
+
+    void Run()
+    {
+        std::string text;
+        while (this->running.load(std::memory_order_acquire))
+        {
+            bool any = false;
+            while (Drain(text))
+                any = true;
+
+            if (any)
+                FlushFiles();
+            else
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        // the shutdown flush is bounded, records which are not drained in time are counted as dropped
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(LOG_FLUSH_TIMEOUT);
+        while (std::chrono::steady_clock::now() < deadline && Drain(text))
+        {
+        }
+        FlushFiles();
+    }
+
+    void FlushFiles()
+    {
+        for (auto& f : this->files)
+        {
+            if (f.second.file != nullptr)
+                fflush(f.second.file);
+        }
+    }
+
+public:
+    void Start(const std::string& nativeDirectory)
+    {
+        if (this->running.exchange(true))
+            return;
+
+        RegisterSink(nativeDirectory);
+        this->drainer = std::thread(&LogRing::Run, this);
+    }
+
+    void Stop()
+    {
+        if (!this->running.exchange(false))
+            return;
+
+        if (this->drainer.joinable())
+            this->drainer.join();
+
+        uint64_t lost = this->dropped.load() + CountPublished();
+        if (lost > 0)
+        {
+            char message[64];
+            int length = snprintf(message, sizeof(message), "Onsharp: %llu log records were dropped", (unsigned long long) lost);
+            ToConsole(message, (size_t) length);
+        }
+
+        for (auto& f : this->files)
+        {
+            if (f.second.file != nullptr)
+                fclose(f.second.file);
+        }
+        this->files.clear();
+    }
+
+    // returns the sink id of the given directory, every sink writes into one file per day
+    int RegisterSink(const std::string& directory)
+    {
+        std::lock_guard<std::mutex> lock(this->sinkMutex);
+        for (size_t i = 0; i < this->sinks.size(); i++)
+        {
+            if (this->sinks[i] == directory)
+                return (int) i;
+        }
+        this->sinks.push_back(directory);
+        return (int) this->sinks.size() - 1;
+    }
+
+    bool Write(int sink, LogLevel level, bool toConsole, const char* text, size_t length)
+    {
+        if (!this->running.load(std::memory_order_relaxed))
+        {
+            if (toConsole)
+                ToConsole(text, length);
+            return false;
+        }
+
+        size_t count = length == 0 ? 1 : (length + LOG_SLOT_TEXT - 1) / LOG_SLOT_TEXT;
+        if (count > LOG_MAX_SLOTS)
+        {
+            count = LOG_MAX_SLOTS;
+            length = LOG_MAX_SLOTS * LOG_SLOT_TEXT;
+        }
+
+        size_t pos = this->enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot& last = this->slots[(pos + count - 1) & (LOG_RING_CAPACITY - 1)];
+            size_t sequence = last.sequence.load(std::memory_order_acquire);
+            auto diff = (intptr_t) sequence - (intptr_t) (pos + count - 1);
+            if (diff == 0)
+            {
+                if (this->enqueuePos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                this->dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                pos = this->enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        int64_t now = (int64_t) std::time(nullptr);
+        for (size_t i = 0; i < count; i++)
+        {
+            Slot& slot = this->slots[(pos + i) & (LOG_RING_CAPACITY - 1)];
+            size_t offset = i * LOG_SLOT_TEXT;
+            size_t part = length - offset < LOG_SLOT_TEXT ? length - offset : LOG_SLOT_TEXT;
+            slot.time = now;
+            slot.sink = (uint16_t) sink;
+            slot.level = (uint8_t) level;
+            slot.slots = (uint8_t) count;
+            slot.toConsole = toConsole;
+            slot.length = (uint16_t) part;
+            memcpy(slot.text, text + offset, part);
+            slot.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return true;
+    }
+
+    // formats the record and writes it into the native sink and the Onset log
+    void Writef(LogLevel level, const char* format, ...)
+    {
+        char buffer[LOG_SLOT_TEXT * 4];
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        if (length < 0)
+            return;
+        Write(0, level, true, buffer, (size_t) length < sizeof(buffer) ? (size_t) length : sizeof(buffer) - 1);
+    }
+
+    uint64_t GetDropped() const
+    {
+        return this->dropped.load(std::memory_order_relaxed);
+    }
+};
+
+#endif
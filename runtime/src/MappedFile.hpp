@@ -0,0 +1,137 @@
+#pragma once
+#ifndef __MAPPED_FILE_H__
+#define __MAPPED_FILE_H__
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// a read only memory mapping of a whole file. An empty file opens successfully but maps nothing
+class MappedFile
+{
+private:
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        Close();
+    }
+
+    bool Open(const std::string& path)
+    {
+        Close();
+#ifdef _WIN32
+        this->file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (this->file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(this->file, &fileSize))
+        {
+            Close();
+            return false;
+        }
+
+        this->size = (size_t) fileSize.QuadPart;
+        if (this->size == 0)
+            return true;
+
+        this->mapping = CreateFileMappingA(this->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (this->mapping == nullptr)
+        {
+            Close();
+            return false;
+        }
+
+        this->data = (const uint8_t*) MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0);
+#else
+        this->fd = open(path.c_str(), O_RDONLY);
+        if (this->fd < 0)
+            return false;
+
+        struct stat info;
+        if (fstat(this->fd, &info) != 0)
+        {
+            Close();
+            return false;
+        }
+
+        this->size = (size_t) info.st_size;
+        if (this->size == 0)
+            return true;
+
+        void* view = mmap(nullptr, this->size, PROT_READ, MAP_SHARED, this->fd, 0);
+        this->data = view == MAP_FAILED ? nullptr : (const uint8_t*) view;
+#endif
+        if (this->data == nullptr)
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close()
+    {
+#ifdef _WIN32
+        if (this->data != nullptr)
+            UnmapViewOfFile(this->data);
+        if (this->mapping != nullptr)
+            CloseHandle(this->mapping);
+        if (this->file != INVALID_HANDLE_VALUE)
+            CloseHandle(this->file);
+        this->mapping = nullptr;
+        this->file = INVALID_HANDLE_VALUE;
+#else
+        if (this->data != nullptr)
+            munmap((void*) this->data, this->size);
+        if (this->fd >= 0)
+            close(this->fd);
+        this->fd = -1;
+#endif
+        this->data = nullptr;
+        this->size = 0;
+    }
+
+    bool IsOpen() const
+    {
+#ifdef _WIN32
+        return this->file != INVALID_HANDLE_VALUE;
+#else
+        return this->fd >= 0;
+#endif
+    }
+
+    const uint8_t* GetData() const
+    {
+        return this->data;
+    }
+
+    size_t GetSize() const
+    {
+        return this->size;
+    }
+};
+
+#endif
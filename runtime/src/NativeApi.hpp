@@ -0,0 +1,289 @@
+#pragma once
+#ifndef __NATIVE_API_H__
+#define __NATIVE_API_H__
+#include <cstdint>
+
+#define NATIVE_API_VERSION 1
+#define MANAGED_CALLBACKS_VERSION 2
+
+// The blittable exports which are handed to the managed side as a function table when loading. New functions may only
+// be appended, the managed NativeApi reads the pointers in exactly this order.
+#define NATIVE_API_FUNCTIONS(X) \
+    X(SetPlayerRagdoll) \
+    X(GetPlayerSteamId) \
+    X(GetPlayerHeadSize) \
+    X(SetPlayerHeadSize) \
+    X(AttachPlayerParachute) \
+    X(GetPlayerGameVersion) \
+    X(GetPlayerGUID) \
+    X(GetPlayerLocale) \
+    X(GetPlayerPing) \
+    X(GetPlayerIP) \
+    X(GetPlayerRespawnTime) \
+    X(SetPlayerRespawnTime) \
+    X(GetPlayerArmor) \
+    X(SetPlayerArmor) \
+    X(GetPlayerHealth) \
+    X(SetPlayerHealth) \
+    X(IsPlayerDead) \
+    X(SetPlayerSpectate) \
+    X(GetPlayerHeading) \
+    X(SetPlayerHeading) \
+    X(EquipPlayerWeaponSlot) \
+    X(GetPlayerEquippedWeaponSlot) \
+    X(SetPlayerWeapon) \
+    X(RemovePlayerFromVehicle) \
+    X(SetPlayerInVehicle) \
+    X(GetPlayerVehicleSeat) \
+    X(GetPlayerVehicle) \
+    X(IsPlayerReloading) \
+    X(IsPlayerAiming) \
+    X(GetPlayerMovementSpeed) \
+    X(GetPlayerMovementMode) \
+    X(GetPlayerState) \
+    X(SetPlayerVoiceDimension) \
+    X(IsPlayerTalking) \
+    X(IsPlayerVoiceEnabled) \
+    X(SetPlayerVoiceEnabled) \
+    X(IsPlayerVoiceChannel) \
+    X(SetPlayerVoiceChannel) \
+    X(SetPlayerSpawnLocation) \
+    X(EnableVehicleBackfire) \
+    X(AttachVehicleNitro) \
+    X(GetVehicleLightEnabled) \
+    X(SetVehicleLightEnabled) \
+    X(GetVehicleEngineState) \
+    X(StopVehicleEngine) \
+    X(StartVehicleEngine) \
+    X(GetVehicleTrunkRatio) \
+    X(SetVehicleTrunkRatio) \
+    X(GetVehicleHoodRatio) \
+    X(SetVehicleHoodRatio) \
+    X(GetVehicleGear) \
+    X(SetVehicleAngularVelocity) \
+    X(SetVehicleLinearVelocity) \
+    X(GetVehicleColor) \
+    X(GetVehicleNumberOfSeats) \
+    X(GetVehiclePassenger) \
+    X(GetVehicleDriver) \
+    X(SetVehicleHealth) \
+    X(GetVehicleHealth) \
+    X(SetVehicleHeading) \
+    X(GetVehicleHeading) \
+    X(SetVehicleRotation) \
+    X(SetVehicleRespawnParams) \
+    X(GetVehicleModelName) \
+    X(GetVehicleModel) \
+    X(GetVehicleLicensePlate) \
+    X(SetVehicleDamage) \
+    X(GetVehicleDamage) \
+    X(CreateVehicle) \
+    X(SetText3DVisibility) \
+    X(SetPickupVisibility) \
+    X(SetPickupScale) \
+    X(CreatePickup) \
+    X(GetObjectModel) \
+    X(SetObjectModel) \
+    X(SetObjectRotateAxis) \
+    X(StopObjectMove) \
+    X(SetObjectMoveTo) \
+    X(IsObjectMoving) \
+    X(IsObjectAttached) \
+    X(SetObjectDetached) \
+    X(SetObjectScale) \
+    X(SetObjectRotation) \
+    X(SetObjectStreamDistance) \
+    X(SetNPCFollowVehicle) \
+    X(SetNPCFollowPlayer) \
+    X(SetNPCTargetLocation) \
+    X(SetNPCHeading) \
+    X(GetNPCHeading) \
+    X(SetNPCHealth) \
+    X(GetNPCHealth) \
+    X(CreateNPC) \
+    X(SetNPCRagdoll) \
+    X(GetDoorModel) \
+    X(SetDoorOpen) \
+    X(GetDoorOpen) \
+    X(CreateDoor) \
+    X(GetDroppedLogCount) \
+    X(StartTrace) \
+    X(IsTraceActive) \
+    X(ConfigureTickMonitor) \
+    X(ConfigureNetworkSampler) \
+    X(IsTimerValid) \
+    X(DestroyTimer) \
+    X(PauseTimer) \
+    X(UnpauseTimer) \
+    X(GetTimerRemainingTime) \
+    X(CreateExplosion) \
+    X(GetMaxPlayers) \
+    X(GetServerName) \
+    X(GetServerTickRate) \
+    X(GetTheTickCount) \
+    X(GetTimeSeconds) \
+    X(GetDeltaSeconds) \
+    X(GetGameVersion) \
+    X(GetGameVersionAsString) \
+    X(CreateObject) \
+    X(GetAllPackages) \
+    X(GetPlayerName) \
+    X(AddValueToTable) \
+    X(RemoveTableKey) \
+    X(ContainsTableKey) \
+    X(GetValueFromTable) \
+    X(GetLengthOfTable) \
+    X(ShutdownServer) \
+    X(CreateNValue_i) \
+    X(CreateNValue_d) \
+    X(CreateNValue_b) \
+    X(CreateNValue_n) \
+    X(CreateNValue_t) \
+    X(FreeNValue) \
+    X(GetNDouble) \
+    X(GetNInt) \
+    X(GetNBoolean) \
+    X(GetNString) \
+    X(CreateNValue_u8) \
+    X(SetPlayerAnimationUtf8) \
+    X(KickPlayerUtf8) \
+    X(SetPlayerNameUtf8) \
+    X(SendPlayerChatMessageUtf8) \
+    X(SetNPCAnimationUtf8) \
+    X(SetVehicleLicensePlateUtf8) \
+    X(SetText3DTextUtf8) \
+    X(CreateText3DUtf8) \
+    X(CallRemoteUtf8) \
+    X(CallRemoteMulticastUtf8) \
+    X(CallRemoteBroadcastUtf8) \
+    X(CallRemoteDimensionUtf8) \
+    X(GetPlayerNameUtf8) \
+    X(GetPlayerIPUtf8) \
+    X(GetPlayerGUIDUtf8) \
+    X(GetPlayerLocaleUtf8) \
+    X(GetVehicleModelNameUtf8) \
+    X(GetVehicleLicensePlateUtf8) \
+    X(GetServerNameUtf8) \
+    X(GetGameVersionAsStringUtf8) \
+    X(GetPlayerStatuses) \
+    X(GetVehicleStatuses) \
+    X(GetNPCStatuses) \
+    X(GetEntityPosition) \
+    X(SetEntityPosition) \
+    X(GetEntityDimension) \
+    X(SetEntityDimension) \
+    X(GetEntityDimensions) \
+    X(GetDimensionMembers) \
+    X(DestroyEntity) \
+    X(IsEntityValid) \
+    X(IsStreamedIn) \
+    X(GetEntityCount) \
+    X(GetEntities) \
+    X(LoadWorldLayoutUtf8) \
+    X(GetWorldLayoutIds) \
+    X(ReleaseWorldLayout) \
+    X(OpenStoreUtf8) \
+    X(CloseStore) \
+    X(PutStoreValue) \
+    X(RemoveStoreValue) \
+    X(GetStoreValue) \
+    X(GetStoreCount) \
+    X(FlushStore) \
+    X(ConfigureWorldSnapshots) \
+    X(RestoreWorldSnapshot) \
+    X(StartBridgeRecordingUtf8) \
+    X(StopBridgeRecording) \
+    X(SetEntityPersistent) \
+    X(GetPropertyValueUtf8) \
+    X(SetPropertyValueUtf8) \
+    X(GetPlayerWeapon) \
+    X(SetPlayerWeaponStatUtf8) \
+    X(SetVehicleColorUtf8) \
+    X(GetVehicleVelocity) \
+    X(GetVehicleRotation) \
+    X(SetText3DAttachedUtf8) \
+    X(GetPickupScale) \
+    X(GetObjectAttachmentInfo) \
+    X(SetObjectAttachedUtf8) \
+    X(GetObjectScale) \
+    X(GetObjectRotation) \
+    X(CreateTimerUtf8) \
+    X(DelayUtf8) \
+    X(SetServerNameUtf8) \
+    X(IsPackageStartedUtf8) \
+    X(StopPackageUtf8) \
+    X(StartPackageUtf8) \
+    X(QueryEntitiesInRadius) \
+    X(QueryEntitiesInBox) \
+    X(QueryNearestEntities) \
+    X(ResolvePackageFunctionUtf8) \
+    X(InvokePackageFunction) \
+    X(ImportPackageUtf8) \
+    X(RegisterRemoteEventUtf8) \
+    X(RegisterCommandUtf8) \
+    X(RegisterCommandAliasUtf8) \
+    X(QueueRemoteUtf8) \
+    X(RegisterLogSinkUtf8) \
+    X(WriteLogUtf8)
+
+struct NativeApi
+{
+    int version;
+    int count;
+    void* const* functions;
+};
+
+// The arguments of the events which fire often enough to skip the generic bridge call. They are passed to the typed
+// managed callbacks as they are, the layouts have to match the structs of the managed NativeEvents.
+struct WeaponShotEvent
+{
+    int player;
+    int weapon;
+    int hitType;
+    int hitId;
+    double hitX, hitY, hitZ;
+    double startX, startY, startZ;
+    double normalX, normalY, normalZ;
+};
+
+static_assert(sizeof(WeaponShotEvent) == 88, "WeaponShotEvent has to match the managed layout");
+
+struct PlayerDamageEvent
+{
+    int player;
+    int damageType;
+    double amount;
+};
+
+static_assert(sizeof(PlayerDamageEvent) == 16, "PlayerDamageEvent has to match the managed layout");
+
+// the player and the entity streamed in or out for them, the type tells which of the stream events it is
+struct StreamEvent
+{
+    int type;
+    int player;
+    int entity;
+};
+
+static_assert(sizeof(StreamEvent) == 12, "StreamEvent has to match the managed layout");
+
+// Filled by the managed side when loading, replaces the lookups of the managed entry points by name.
+struct ManagedCallbacks
+{
+    int version;
+    void (*unload)();
+    void (*init)();
+    void (*triggerTick)();
+    void* (*callBridge)(const char* key, void** args, int len);
+    uint8_t (*weaponShot)(const WeaponShotEvent* args);
+    uint8_t (*playerDamage)(const PlayerDamageEvent* args);
+    void (*stream)(const StreamEvent* args);
+    void (*gameTick)(double delta);
+};
+
+const NativeApi* GetNativeApi();
+// the same table with every export wrapped to be recorded, see BridgeRecorder
+const NativeApi* GetRecordingNativeApi();
+const char* const* GetNativeApiNames();
+
+#endif
@@ -17,6 +17,7 @@
 #include <string>
 
 #include "coreclrhost.h"
+#include "NativeApi.hpp"
 
 #define NET_NO_ERROR 0
 #define NET_CONSOLE_ERROR -1
@@ -42,11 +43,15 @@
 #endif
 
 typedef int (*report_callback_ptr)(int progress);
-typedef void (*load_ptr)(const char* appPath);
+typedef void (*load_ptr)(const char* appPath, const NativeApi* api, ManagedCallbacks* callbacks);
 typedef void (*unload_ptr)();
 typedef void (*init_ptr)();
 typedef void (*trigger_tick_ptr)();
 typedef void* (*call_bridge_ptr)(const char* key, void** args, int len);
+typedef uint8_t (*weapon_shot_ptr)(const WeaponShotEvent* args);
+typedef uint8_t (*player_damage_ptr)(const PlayerDamageEvent* args);
+typedef void (*stream_ptr)(const StreamEvent* args);
+typedef void (*game_tick_ptr)(double delta);
 
 #ifdef __cplusplus
 extern "C"
@@ -61,10 +66,15 @@ private:
     coreclr_initialize_ptr initializeCoreClr;
     coreclr_create_delegate_ptr createManagedDelegate;
     coreclr_shutdown_ptr shutdownCoreClr;
-    unload_ptr unload;
-    init_ptr init;
-    trigger_tick_ptr triggerTick;
-    call_bridge_ptr callBridge;
+    // stay null while the managed runtime is not loaded, the calls into it are skipped then
+    unload_ptr unload = nullptr;
+    init_ptr init = nullptr;
+    trigger_tick_ptr triggerTick = nullptr;
+    call_bridge_ptr callBridge = nullptr;
+    weapon_shot_ptr weaponShot = nullptr;
+    player_damage_ptr playerDamage = nullptr;
+    stream_ptr stream = nullptr;
+    game_tick_ptr gameTick = nullptr;
 
 public:
     int last_error = NET_NO_ERROR;
@@ -265,88 +275,89 @@ public:
             return;
         }
 
-        hr = createManagedDelegate(
-                hostHandle,
-                domainId,
-                "Onsharp",
-                "Onsharp.Native.Bridge",
-                "InitRuntimeEntries",
-                (void**)&init);
-
-        if (hr < 0)
+        // the managed side hands its entry points back as function pointers instead of them being looked up by name
+        ManagedCallbacks callbacks = {};
+        managedDelegate(appPath.c_str(), GetNativeApi(), &callbacks);
+        if (callbacks.version != MANAGED_CALLBACKS_VERSION || callbacks.unload == nullptr || callbacks.init == nullptr
+            || callbacks.triggerTick == nullptr || callbacks.callBridge == nullptr || callbacks.weaponShot == nullptr
+            || callbacks.playerDamage == nullptr || callbacks.stream == nullptr || callbacks.gameTick == nullptr)
         {
-            printf("ERROR: unload delegate failed - status: 0x%08x\n", hr);
+            printf("ERROR: managed callbacks v%d do not match v%d\n", callbacks.version, MANAGED_CALLBACKS_VERSION);
             last_error = NET_CONSOLE_ERROR;
             return;
         }
 
-        hr = createManagedDelegate(
-                hostHandle,
-                domainId,
-                "Onsharp",
-                "Onsharp.Native.Bridge",
-                "CallBridge",
-                (void**)&callBridge);
-
-        if (hr < 0)
-        {
-            printf("ERROR: call_bridge delegate failed - status: 0x%08x\n", hr);
-            last_error = NET_CONSOLE_ERROR;
-            return;
-        }
+        unload = callbacks.unload;
+        init = callbacks.init;
+        triggerTick = callbacks.triggerTick;
+        callBridge = callbacks.callBridge;
+        weaponShot = callbacks.weaponShot;
+        playerDamage = callbacks.playerDamage;
+        stream = callbacks.stream;
+        gameTick = callbacks.gameTick;
+        last_error = NET_SUCCESS;
+    }
 
-        hr = createManagedDelegate(
-                hostHandle,
-                domainId,
-                "Onsharp",
-                "Onsharp.Native.Bridge",
-                "TriggerTick",
-                (void**)&triggerTick);
+    bool IsLoaded() const
+    {
+        return callBridge != nullptr;
+    }
 
-        if (hr < 0)
-        {
-            printf("ERROR: trigger_tick delegate failed - status: 0x%08x\n", hr);
-            last_error = NET_CONSOLE_ERROR;
-            return;
-        }
+    void* CallBridge(const char* key, void** args, int len)
+    {
+        return callBridge == nullptr ? nullptr : callBridge(key, args, len);
+    }
 
-        hr = createManagedDelegate(
-                hostHandle,
-                domainId,
-                "Onsharp",
-                "Onsharp.Native.Bridge",
-                "Unload",
-                (void**)&unload);
+    // the typed event calls return true if the event was not cancelled
+    bool CallWeaponShot(const WeaponShotEvent& args)
+    {
+        return weaponShot == nullptr || weaponShot(&args) != 0;
+    }
 
-        if (hr < 0)
-        {
-            printf("ERROR: unload delegate failed - status: 0x%08x\n", hr);
-            last_error = NET_CONSOLE_ERROR;
-            return;
-        }
+    bool CallPlayerDamage(const PlayerDamageEvent& args)
+    {
+        return playerDamage == nullptr || playerDamage(&args) != 0;
+    }
 
-        managedDelegate(appPath.c_str());
-        last_error = NET_SUCCESS;
+    void CallStream(const StreamEvent& args)
+    {
+        if (stream != nullptr)
+            stream(&args);
     }
 
-    void* CallBridge(const char* key, void** args, int len)
+    void CallGameTick(double delta)
     {
-        return callBridge(key, args, len);
+        if (gameTick != nullptr)
+            gameTick(delta);
     }
 
     void InitRuntime()
     {
-        init();
+        if (init != nullptr)
+            init();
     }
 
     void TriggerTick()
     {
-        triggerTick();
+        if (triggerTick != nullptr)
+            triggerTick();
     }
 
     void Stop()
     {
+        if (unload == nullptr)
+            return;
+
         unload();
+        // the runtime is gone after the shutdown, so none of its entry points may be called anymore
+        unload = nullptr;
+        init = nullptr;
+        triggerTick = nullptr;
+        callBridge = nullptr;
+        weaponShot = nullptr;
+        playerDamage = nullptr;
+        stream = nullptr;
+        gameTick = nullptr;
         int hr = shutdownCoreClr(hostHandle, domainId);
         if (hr >= 0)
         {
@@ -0,0 +1,163 @@
+#pragma once
+#ifndef __NET_STATS_SAMPLER_H__
+#define __NET_STATS_SAMPLER_H__
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <PluginSDK.h>
+#include "Singleton.hpp"
+#include "EntityRegistry.hpp"
+
+#define NET_STATS_FIELDS 11
+#define NET_STATS_CAPACITY 60
+
+class NetStatsSampler : public Singleton<NetStatsSampler>
+{
+    friend class Singleton<NetStatsSampler>;
+private:
+    struct Ring
+    {
+        double samples[NET_STATS_CAPACITY][NET_STATS_FIELDS];
+        int head = 0;
+        int count = 0;
+
+        void Push(const double* sample)
+        {
+            std::copy(sample, sample + NET_STATS_FIELDS, this->samples[this->head]);
+            this->head = (this->head + 1) % NET_STATS_CAPACITY;
+            if (this->count < NET_STATS_CAPACITY)
+                this->count++;
+        }
+    };
+
+    Ring server;
+    std::unordered_map<int, Ring> players;
+    float interval = 1.0f;
+    int spreadTicks = 10;
+    float elapsed = 0;
+    std::vector<int> sweep;
+    size_t sweepIndex = 0;
+    size_t sweepBatch = 0;
+
+    NetStatsSampler() = default;
+    ~NetStatsSampler() = default;
+
+    static bool Fetch(lua_State* L, int source, double* sample)
+    {
+        int top = lua_gettop(L);
+        bool ok = false;
+        if (source <= 0)
+        {
+            lua_getglobal(L, "GetNetworkStats");
+            ok = lua_pcall(L, 0, NET_STATS_FIELDS, 0) == LUA_OK;
+        }
+        else
+        {
+            lua_getglobal(L, "GetPlayerNetworkStats");
+            lua_pushinteger(L, source);
+            ok = lua_pcall(L, 1, NET_STATS_FIELDS, 0) == LUA_OK;
+        }
+
+        ok = ok && lua_isnumber(L, top + 1);
+        if (ok)
+        {
+            for (int i = 0; i < NET_STATS_FIELDS; i++)
+            {
+                int idx = top + 1 + i;
+                sample[i] = lua_type(L, idx) == LUA_TBOOLEAN ? (lua_toboolean(L, idx) ? 1 : 0) : lua_tonumber(L, idx);
+            }
+        }
+        lua_settop(L, top);
+        return ok;
+    }
+
+    void Sample(lua_State* L, int player)
+    {
+        double sample[NET_STATS_FIELDS];
+        if (EntityRegistry::Get()->IsValid(EntityType::Player, player) && Fetch(L, player, sample))
+            this->players[player].Push(sample);
+    }
+
+public:
+    // an interval of zero or less disables the sampler, the players are spread over the given count of ticks
+    void Configure(float interval, int spreadTicks)
+    {
+        this->interval = interval;
+        this->spreadTicks = spreadTicks < 1 ? 1 : spreadTicks;
+        this->elapsed = 0;
+    }
+
+    void Tick(lua_State* L, float delta)
+    {
+        if (L == nullptr || this->interval <= 0)
+            return;
+
+        for (size_t n = 0; n < this->sweepBatch && this->sweepIndex < this->sweep.size(); n++)
+        {
+            Sample(L, this->sweep[this->sweepIndex++]);
+        }
+
+        this->elapsed += delta;
+        if (this->elapsed < this->interval)
+            return;
+
+        this->elapsed = 0;
+        double sample[NET_STATS_FIELDS];
+        if (Fetch(L, 0, sample))
+            this->server.Push(sample);
+
+        // an interval shorter than the spread would cut the sweep off before it reached its last players
+        if (this->sweepIndex < this->sweep.size())
+            return;
+
+        this->sweep = EntityRegistry::Get()->GetIds(EntityType::Player);
+        this->sweepIndex = 0;
+        this->sweepBatch = (this->sweep.size() + this->spreadTicks - 1) / this->spreadTicks;
+    }
+
+    void Drop(int player)
+    {
+        this->players.erase(player);
+    }
+
+    // aggregates the given field over the latest samples of the source, returns the count of used samples
+    int Aggregate(int source, int field, int window, double* min, double* max, double* avg, double* p95) const
+    {
+        if (field < 0 || field >= NET_STATS_FIELDS)
+            return 0;
+
+        const Ring* ring = &this->server;
+        if (source > 0)
+        {
+            auto it = this->players.find(source);
+            if (it == this->players.end())
+                return 0;
+            ring = &it->second;
+        }
+
+        int count = window <= 0 || window > ring->count ? ring->count : window;
+        if (count == 0)
+            return 0;
+
+        std::vector<double> values;
+        values.reserve(count);
+        double sum = 0;
+        for (int i = 0; i < count; i++)
+        {
+            int idx = (ring->head - 1 - i + NET_STATS_CAPACITY) % NET_STATS_CAPACITY;
+            double value = ring->samples[idx][field];
+            values.push_back(value);
+            sum += value;
+        }
+
+        *min = *std::min_element(values.begin(), values.end());
+        *max = *std::max_element(values.begin(), values.end());
+        *avg = sum / count;
+        size_t rank = (size_t) ((count * 95 + 99) / 100) - 1;
+        std::nth_element(values.begin(), values.begin() + rank, values.end());
+        *p95 = values[rank];
+        return count;
+    }
+};
+
+#endif
@@ -13,6 +13,21 @@ namespace fs = std::filesystem;
 #endif
 
 #include "Plugin.hpp"
+#include "RemoteBatch.hpp"
+#include "PropertyStore.hpp"
+#include "EntityRegistry.hpp"
+#include "SpatialIndex.hpp"
+#include "DimensionIndex.hpp"
+#include "SimdKernels.hpp"
+#include "NetStatsSampler.hpp"
+#include "LogRing.hpp"
+#include "TraceRecorder.hpp"
+#include "EntityStatus.hpp"
+#include "EntityFunctions.hpp"
+#include "WorldLoader.hpp"
+#include "KvStore.hpp"
+#include "WorldSnapshot.hpp"
+#include "BridgeRecorder.hpp"
 
 #if defined _WIN32 || defined __CYGWIN__
 #ifdef BUILDING_DLL
@@ -45,31 +60,240 @@ namespace fs = std::filesystem;
 #define LUA_DEFINE(name) Define(#name, [](lua_State *L) -> int
 
 Lua::LuaArgs_t Plugin::CallLuaFunction(const char* LuaFunctionName, Lua::LuaArgs_t* Arguments) {
+    return CallLuaFunction(Plugin::MainScriptVM, LuaFunctionName, Arguments);
+}
+
+Lua::LuaArgs_t Plugin::CallLuaFunction(lua_State* L, const char* LuaFunctionName, Lua::LuaArgs_t* Arguments) {
+    TraceScope scope(TraceCategory::Lua, LuaFunctionName);
     Lua::LuaArgs_t ReturnValues;
-    int ArgCount = lua_gettop(Plugin::MainScriptVM);
-    lua_getglobal(Plugin::MainScriptVM, LuaFunctionName);
+    int ArgCount = lua_gettop(L);
+    lua_getglobal(L, LuaFunctionName);
     int argc = 0;
     if (Arguments) {
         for (auto const& e : *Arguments) {
-            Lua::PushValueToLua(e, Plugin::MainScriptVM);
+            Lua::PushValueToLua(e, L);
             argc++;
         }
     }
-    int Status = lua_pcall(Plugin::MainScriptVM, argc, LUA_MULTRET, 0);
-    ArgCount = lua_gettop(Plugin::MainScriptVM) - ArgCount;
+    int Status = lua_pcall(L, argc, LUA_MULTRET, 0);
+    ArgCount = lua_gettop(L) - ArgCount;
     if (Status == LUA_OK) {
-        Lua::ParseArguments(Plugin::MainScriptVM, ReturnValues);
-        lua_pop(Plugin::MainScriptVM, ArgCount);
+        Lua::ParseArguments(L, ReturnValues);
+        lua_pop(L, ArgCount);
     }
     return ReturnValues;
 }
 
 void Plugin::ClearLuaStack()
 {
-    Lua::LuaArgs_t stack;
-    Lua::ParseArguments(Plugin::MainScriptVM, stack);
-    int stack_size = static_cast<int>(stack.size());
-    lua_pop(Plugin::MainScriptVM, stack_size);
+    ClearLuaStack(Plugin::MainScriptVM);
+}
+
+void Plugin::ClearLuaStack(lua_State* L)
+{
+    lua_settop(L, 0);
+}
+
+void Plugin::ObserveEvent(int type, NValue* args[], int len)
+{
+    if (len < 2)
+        return;
+
+    int id = args[1]->iVal;
+    switch (type)
+    {
+        case 3: // PlayerJoin
+        case 22: // PlayerServerAuth
+            OnEntityCreated(EntityType::Player, id);
+            break;
+        case 40: // PlayerChangeDimension
+            OnEntityDimensionChanged(EntityType::Player, id, args, len);
+            break;
+        case 41: // VehicleChangeDimension
+            OnEntityDimensionChanged(EntityType::Vehicle, id, args, len);
+            break;
+        case 42: // Text3DChangeDimension
+            OnEntityDimensionChanged(EntityType::Text3D, id, args, len);
+            break;
+        case 43: // PickupChangeDimension
+            OnEntityDimensionChanged(EntityType::Pickup, id, args, len);
+            break;
+        case 44: // ObjectChangeDimension
+            OnEntityDimensionChanged(EntityType::Object, id, args, len);
+            break;
+        case 45: // NPCChangeDimension
+            OnEntityDimensionChanged(EntityType::NPC, id, args, len);
+            break;
+        case 46: // ObjectCreated
+            OnEntityCreated(EntityType::Object, id);
+            break;
+        case 47: // VehicleCreated
+            OnEntityCreated(EntityType::Vehicle, id);
+            break;
+        case 48: // Text3DCreated
+            OnEntityCreated(EntityType::Text3D, id);
+            break;
+        case 49: // PickupCreated
+            OnEntityCreated(EntityType::Pickup, id);
+            break;
+        case 50: // NPCCreated
+            OnEntityCreated(EntityType::NPC, id);
+            break;
+        case 51: // DoorCreated
+            OnEntityCreated(EntityType::Door, id);
+            break;
+        case 52: // ObjectStopMoving
+            SpatialIndex::Get()->StopMoving(EntityType::Object, id);
+            break;
+        default:
+            break;
+    }
+}
+
+void Plugin::ObserveHandledEvent(int type, NValue* args[], int len)
+{
+    if (len < 2)
+        return;
+
+    int id = args[1]->iVal;
+    switch (type)
+    {
+        case 0: // PlayerQuit
+            OnEntityDestroyed(EntityType::Player, id);
+            break;
+        case 35: // DoorDestroyed
+            OnEntityDestroyed(EntityType::Door, id);
+            break;
+        case 36: // NPCDestroyed
+            OnEntityDestroyed(EntityType::NPC, id);
+            break;
+        case 37: // ObjectDestroyed
+            OnEntityDestroyed(EntityType::Object, id);
+            break;
+        case 38: // PickupDestroyed
+            OnEntityDestroyed(EntityType::Pickup, id);
+            break;
+        case 39: // Text3DDestroyed
+            OnEntityDestroyed(EntityType::Text3D, id);
+            break;
+        default:
+            break;
+    }
+}
+
+void Plugin::RecordTypedEvent(int eventType, lua_State* L, int first, int count)
+{
+    std::vector<NValue*> args;
+    args.reserve(count + 1);
+    NValue* type = new NValue;
+    type->type = NTYPE::INTEGER;
+    type->iVal = eventType;
+    args.push_back(type);
+    for (int i = 0; i < count; i++)
+        args.push_back(CreateNValueByStack(L, first + i));
+
+    BridgeRecorder::Get()->RecordCall("call-event", args.data(), (int) args.size());
+    for (NValue* arg : args)
+        delete arg;
+}
+
+void Plugin::OnEntityDimensionChanged(EntityType type, int id, NValue* args[], int len)
+{
+    if (len < 3)
+        return;
+
+    SetEntityDimension(type, id, (uint32_t) args[2]->iVal);
+}
+
+void Plugin::SetEntityDimension(EntityType type, int id, uint32_t dimension)
+{
+    DimensionIndex::Get()->Set(type, id, dimension);
+    SpatialIndex::Get()->UpdateDimension(type, id, dimension);
+}
+
+void Plugin::OnEntityCreated(EntityType type, int id)
+{
+    EntityRegistry::Get()->Add(type, id);
+    uint32_t dimension = 0;
+    if (!DimensionIndex::Get()->TryGet(type, id, dimension))
+        DimensionIndex::Get()->Set(type, id, 0);
+    SpatialIndex::Get()->MarkDirty(type, id);
+}
+
+void Plugin::OnEntityDestroyed(EntityType type, int id)
+{
+    EntityRegistry::Get()->Remove(type, id);
+    SpatialIndex::Get()->Remove(type, id);
+    DimensionIndex::Get()->Remove(type, id);
+    PropertyStore::Get()->Purge(type, id);
+    WorldSnapshot::Get()->SetPersistent(type, id, false);
+    if (type == EntityType::Player)
+    {
+        RemoteBatch::Get()->Drop(id);
+        NetStatsSampler::Get()->Drop(id);
+    }
+}
+
+std::vector<int> Plugin::GetAllPlayers()
+{
+    lua_State* L = Plugin::MainScriptVM;
+    std::vector<int> players;
+    int top = lua_gettop(L);
+    lua_getglobal(L, "GetAllPlayers");
+    if (lua_pcall(L, 0, 1, 0) == LUA_OK && lua_istable(L, -1))
+    {
+        players.reserve(lua_rawlen(L, -1));
+        lua_pushnil(L);
+        while (lua_next(L, -2) != 0)
+        {
+            players.push_back((int) lua_tointeger(L, -1));
+            lua_pop(L, 1);
+        }
+    }
+    lua_settop(L, top);
+    return players;
+}
+
+void Plugin::CallRemoteEvents(const int* players, int count, LuaString name, NValue* nVals[], int len)
+{
+    lua_State* L = Plugin::MainScriptVM;
+    int top = lua_gettop(L);
+    if (count <= 0)
+        return;
+
+    // the payload with the function and the name and a copy of it with the player for every call
+    if (!lua_checkstack(L, 2 * len + 5))
+    {
+        LogRing::Get()->Writef(LogLevel::Error, "Onsharp: no stack space for remote event %.*s with %d values",
+                name.length, name.data, len);
+        return;
+    }
+
+    // the payload is converted once and every call only copies the stack slots
+    lua_getglobal(L, "CallRemoteEvent");
+    PushDirect(L, name);
+    for (int i = 0; i < len; i++)
+    {
+        nVals[i]->PushToLua(L);
+    }
+
+    for (int p = 0; p < count; p++)
+    {
+        lua_pushvalue(L, top + 1);
+        lua_pushinteger(L, players[p]);
+        for (int i = 2; i <= len + 2; i++)
+        {
+            lua_pushvalue(L, top + i);
+        }
+
+        if (lua_pcall(L, len + 2, 0, 0) != LUA_OK)
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: remote event %.*s failed: %s", name.length, name.data,
+                    lua_tostring(L, -1));
+            lua_pop(L, 1);
+        }
+    }
+    lua_settop(L, top);
 }
 
 Plugin::Plugin()
@@ -85,8 +309,17 @@ Plugin::Plugin()
             (void) k;
             args[k.GetValue<int>()-1] = Plugin::Get()->CreateNValueByLua(std::move(v));
         });
-        Plugin::Get()->ClearLuaStack();
+        Plugin::Get()->ClearLuaStack(L);
+        bool event = key == "call-event" && len > 0;
+        if(event) {
+            Plugin::Get()->ObserveEvent(((NValue*) args[0])->iVal, (NValue**) args, len);
+        }
         NValue* returnVal = Plugin::Get()->CallBridge(key.c_str(), args, len);
+        if(event) {
+            Plugin::Get()->ObserveHandledEvent(((NValue*) args[0])->iVal, (NValue**) args, len);
+        }
+        if (returnVal == nullptr)
+            return 0;
         if(key == "call-event") {
             Lua::LuaArgs_t argValues = Lua::BuildArgumentList(returnVal->GetLuaValue());
             return Lua::ReturnValues(L, argValues);
@@ -95,6 +328,100 @@ Plugin::Plugin()
         return 0;
     });
 
+    LUA_DEFINE(CallCommand)
+    {
+        int len = lua_gettop(L);
+        if (len < 2)
+            return 0;
+
+        void** args = new void*[len];
+        args[0] = Plugin::Get()->CreateNValueByStack(L, 1);
+        args[1] = Plugin::Get()->CreateNValueByStack(L, 2);
+        for (int i = 2; i < len; i++)
+        {
+            NValue* nVal = new NValue;
+            nVal->type = NTYPE::STRING;
+            if (lua_type(L, i + 1) == LUA_TBOOLEAN)
+            {
+                nVal->sVal = lua_toboolean(L, i + 1) ? "true" : "false";
+            }
+            else
+            {
+                size_t strLen = 0;
+                const char* str = lua_tolstring(L, i + 1, &strLen);
+                if (str != nullptr)
+                    nVal->sVal.assign(str, strLen);
+            }
+            args[i] = nVal;
+        }
+
+        Plugin::Get()->ClearLuaStack(L);
+        NValue* returnVal = Plugin::Get()->CallBridge("call-command", args, len);
+        for (int i = 0; i < len; i++)
+        {
+            delete (NValue*) args[i];
+        }
+        delete[] args;
+        delete returnVal;
+        return 0;
+    });
+
+    // the events with a typed fast path, the arguments are read from the stack in the order of the managed event
+
+    LUA_DEFINE(CallWeaponShot)
+    {
+        WeaponShotEvent args = {
+            (int) lua_tointeger(L, 1), (int) lua_tointeger(L, 2), (int) lua_tointeger(L, 3), (int) lua_tointeger(L, 4),
+            lua_tonumber(L, 5), lua_tonumber(L, 6), lua_tonumber(L, 7),
+            lua_tonumber(L, 8), lua_tonumber(L, 9), lua_tonumber(L, 10),
+            lua_tonumber(L, 11), lua_tonumber(L, 12), lua_tonumber(L, 13)
+        };
+        bool result = Plugin::Get()->CallTypedEvent(29, L, 1, 13, [&args](NetBridge& bridge) {
+            return bridge.CallWeaponShot(args);
+        });
+        lua_settop(L, 0);
+        lua_pushboolean(L, result);
+        return 1;
+    });
+
+    LUA_DEFINE(CallPlayerDamage)
+    {
+        PlayerDamageEvent args = { (int) lua_tointeger(L, 1), (int) lua_tointeger(L, 2), lua_tonumber(L, 3) };
+        bool result = Plugin::Get()->CallTypedEvent(30, L, 1, 3, [&args](NetBridge& bridge) {
+            return bridge.CallPlayerDamage(args);
+        });
+        lua_settop(L, 0);
+        lua_pushboolean(L, result);
+        return 1;
+    });
+
+    LUA_DEFINE(CallStreamEvent)
+    {
+        StreamEvent args = { (int) lua_tointeger(L, 1), (int) lua_tointeger(L, 2), (int) lua_tointeger(L, 3) };
+        Plugin::Get()->CallTypedEvent(args.type, L, 2, 2, [&args](NetBridge& bridge) {
+            bridge.CallStream(args);
+        });
+        lua_settop(L, 0);
+        return 0;
+    });
+
+    LUA_DEFINE(CallGameTick)
+    {
+        double delta = lua_tonumber(L, 1);
+        Plugin::Get()->CallTypedEvent(8, L, 1, 1, [delta](NetBridge& bridge) {
+            bridge.CallGameTick(delta);
+        });
+        lua_settop(L, 0);
+        return 0;
+    });
+
+    LUA_DEFINE(AcknowledgeRemoteBatch)
+    {
+        RemoteBatch::Get()->Acknowledge((int) lua_tointeger(L, 1), (int) lua_tointeger(L, 2));
+        lua_settop(L, 0);
+        return 0;
+    });
+
     LUA_DEFINE(InitRuntimeEntries)
     {
         Plugin::Get()->GetBridge().InitRuntime();
@@ -106,42 +433,65 @@ Plugin::Plugin()
 
     LUA_DEFINE(CallOnsharp)
     {
-        std::string pluginId;
-        std::string funcName;
-        Lua::LuaTable_t args_table;
-        Lua::ParseArguments(L, pluginId, funcName, args_table);
-        int len = args_table->Count();
+        int top = lua_gettop(L);
+        if (top < 2)
+            return 0;
+
+        // legacy callers pass the arguments as one table, everyone else passes them directly
+        bool packed = top == 3 && lua_istable(L, 3);
+        int len = packed ? static_cast<int>(lua_rawlen(L, 3)) : top - 2;
         void** args = new void*[len + 2];
-        args[0] = Plugin::Get()->CreatNValueByString(pluginId);
-        args[1] = Plugin::Get()->CreatNValueByString(funcName);
-        args_table->ForEach([args](Lua::LuaValue k, Lua::LuaValue v) {
-            (void) k;
-            args[k.GetValue<int>()+1] = Plugin::Get()->CreateNValueByLua(std::move(v));
-        });
-        Plugin::Get()->ClearLuaStack();
-        NValue* returnVal = Plugin::Get()->CallBridge("interop", args, len);
-        Lua::LuaArgs_t argValues = Lua::BuildArgumentList(returnVal->GetLuaValue());
-        return Lua::ReturnValues(L, argValues);
+        args[0] = Plugin::Get()->CreateNValueByStack(L, 1);
+        args[1] = Plugin::Get()->CreateNValueByStack(L, 2);
+        for (int i = 0; i < len; i++)
+        {
+            if (packed)
+            {
+                lua_rawgeti(L, 3, i + 1);
+                args[i + 2] = Plugin::Get()->CreateNValueByStack(L, -1);
+                lua_pop(L, 1);
+            }
+            else
+            {
+                args[i + 2] = Plugin::Get()->CreateNValueByStack(L, i + 3);
+            }
+        }
+
+        Plugin::Get()->ClearLuaStack(L);
+        NValue* returnVal = Plugin::Get()->CallBridge("interop", args, len + 2);
+        for (int i = 0; i < len + 2; i++)
+        {
+            delete (NValue*) args[i];
+        }
+        delete[] args;
+
+        if (returnVal == nullptr)
+        {
+            lua_pushnil(L);
+            return 1;
+        }
+
+        returnVal->PushToLua(L);
+        delete returnVal;
+        return 1;
     });
 }
 
 //region Native Bridge Functions
 
-EXPORTED Plugin::NValue* GetPropertyValue(const char* entityName, int entity, const char* propertyKey)
+EXPORTED Plugin::NValue* GetPropertyValue(int type, int entity, const char* propertyKey)
 {
-    std::string funcName = "Get" + std::string(entityName) + "PropertyValue";
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(entity, propertyKey);
-    Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction(funcName.c_str(), &args);
-    return Plugin::Get()->CreateNValueByLua(returnValues.at(0));
+    static constexpr decltype(&EntityFunctions::GetPropertyValue<EntityType::Player>) getters[] =
+            ENTITY_TYPE_TABLE(EntityFunctions::GetPropertyValue);
+    return IsEntityType(type) ? getters[type](entity, propertyKey) : new Plugin::NValue();
 }
 
-EXPORTED void SetPropertyValue(const char* entityName, int entity, const char* propertyKey, Plugin::NValue* propertyValue, bool sync)
+EXPORTED void SetPropertyValue(int type, int entity, const char* propertyKey, Plugin::NValue* propertyValue, bool sync)
 {
-    std::string funcName = "Set" + std::string(entityName) + "PropertyValue";
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(entity, propertyKey);
-    propertyValue->AddAsArg(&args);
-    args.emplace_back(sync);
-    Plugin::Get()->CallLuaFunction(funcName.c_str(), &args);
+    static constexpr decltype(&EntityFunctions::SetPropertyValue<EntityType::Player>) setters[] =
+            ENTITY_TYPE_TABLE(EntityFunctions::SetPropertyValue);
+    if (IsEntityType(type))
+        setters[type](entity, propertyKey, propertyValue, sync);
 }
 
 EXPORTED bool SetPlayerRagdoll(int player, bool enable)
@@ -661,7 +1011,10 @@ EXPORTED int CreateVehicle(int model, double x, double y, double z, double headi
 {
     Lua::LuaArgs_t args = Lua::BuildArgumentList(model, x, y, z, heading);
     Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction("CreateVehicle", &args);
-    return returnValues.at(0).GetValue<int>();
+    int id = returnValues.at(0).GetValue<int>();
+    if (id > 0)
+        Plugin::Get()->OnEntityCreated(EntityType::Vehicle, id);
+    return id;
 }
 
 EXPORTED void SetText3DText(int text3d, const char* text)
@@ -687,7 +1040,10 @@ EXPORTED int CreateText3D(const char* text, int size, double x, double y, double
 {
     Lua::LuaArgs_t args = Lua::BuildArgumentList(text, size, x, y, z, rx, ry, rz);
     Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction("CreateText3D", &args);
-    return returnValues.at(0).GetValue<int>();
+    int id = returnValues.at(0).GetValue<int>();
+    if (id > 0)
+        Plugin::Get()->OnEntityCreated(EntityType::Text3D, id);
+    return id;
 }
 
 EXPORTED void SetPickupVisibility(int pickup, int player, bool visible)
@@ -715,7 +1071,10 @@ EXPORTED int CreatePickup(int model, double x, double y, double z)
 {
     Lua::LuaArgs_t args = Lua::BuildArgumentList(model, x, y, z);
     Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction("CreatePickup", &args);
-    return returnValues.at(0).GetValue<int>();
+    int id = returnValues.at(0).GetValue<int>();
+    if (id > 0)
+        Plugin::Get()->OnEntityCreated(EntityType::Pickup, id);
+    return id;
 }
 
 EXPORTED int GetObjectModel(int obj)
@@ -741,12 +1100,14 @@ EXPORTED void StopObjectMove(int obj)
 {
     Lua::LuaArgs_t args = Lua::BuildArgumentList(obj);
     Plugin::Get()->CallLuaFunction("StopObjectMove", &args);
+    SpatialIndex::Get()->StopMoving(EntityType::Object, obj);
 }
 
 EXPORTED void SetObjectMoveTo(int obj, double x, double y, double z, double speed)
 {
     Lua::LuaArgs_t args = Lua::BuildArgumentList(obj, x, y, z, speed);
     Plugin::Get()->CallLuaFunction("SetObjectMoveTo", &args);
+    SpatialIndex::Get()->MarkMoving(EntityType::Object, obj);
 }
 
 EXPORTED bool IsObjectMoving(int obj)
@@ -775,6 +1136,7 @@ EXPORTED void SetObjectDetached(int obj)
 {
     Lua::LuaArgs_t args = Lua::BuildArgumentList(obj);
     Plugin::Get()->CallLuaFunction("SetObjectDetached", &args);
+    SpatialIndex::Get()->StopMoving(EntityType::Object, obj);
 }
 
 EXPORTED void SetObjectAttached(int obj, int attachType, int entity, double x, double y, double z,
@@ -782,6 +1144,7 @@ EXPORTED void SetObjectAttached(int obj, int attachType, int entity, double x, d
 {
     Lua::LuaArgs_t args = Lua::BuildArgumentList(obj, attachType, entity, x, y, z, rx, ry, rz, socketName);
     Plugin::Get()->CallLuaFunction("SetObjectAttached", &args);
+    SpatialIndex::Get()->MarkMoving(EntityType::Object, obj);
 }
 
 EXPORTED void GetObjectScale(int obj, double* x, double* y, double* z)
@@ -824,7 +1187,10 @@ EXPORTED int CreateObject(int model, double x, double y, double z, double rx, do
 {
     Lua::LuaArgs_t argValues = Lua::BuildArgumentList(model, x, y, z, rx, ry, rz, sx, sy, sz);
     Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction("CreateObject", &argValues);
-    return returnValues.at(0).GetValue<int>();
+    int id = returnValues.at(0).GetValue<int>();
+    if (id > 0)
+        Plugin::Get()->OnEntityCreated(EntityType::Object, id);
+    return id;
 }
 
 EXPORTED void SetNPCFollowVehicle(int npc, int vehicle, double speed)
@@ -877,19 +1243,21 @@ EXPORTED void SetNPCHealth(int npc, double health)
     Plugin::Get()->CallLuaFunction("SetNPCHealth", &args);
 }
 
-EXPORTED bool IsStreamedIn(const char* name, int player, int entity)
+EXPORTED bool IsStreamedIn(int type, int player, int entity)
 {
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(player, entity);
-    std::string funcName = "Is" + std::string(name) + "StreamedIn";
-    Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction(funcName.c_str(), &args);
-    return returnValues.at(0).GetValue<bool>();
+    static constexpr decltype(&EntityFunctions::IsStreamedIn<EntityType::Player>) checks[] =
+            ENTITY_TYPE_TABLE(EntityFunctions::IsStreamedIn);
+    return IsEntityType(type) && checks[type](player, entity);
 }
 
 EXPORTED int CreateNPC(double x, double y, double z, double heading)
 {
     Lua::LuaArgs_t args = Lua::BuildArgumentList(x, y, z, heading);
     Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction("CreateNPC", &args);
-    return returnValues.at(0).GetValue<int>();
+    int id = returnValues.at(0).GetValue<int>();
+    if (id > 0)
+        Plugin::Get()->OnEntityCreated(EntityType::NPC, id);
+    return id;
 }
 
 EXPORTED void SetNPCRagdoll(int npc, bool enable)
@@ -922,29 +1290,60 @@ EXPORTED int CreateDoor(int model, double x, double y, double z, double yaw, boo
 {
     Lua::LuaArgs_t args = Lua::BuildArgumentList(model, x, y, z, yaw, enableInteract);
     Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction("CreateDoor", &args);
-    return returnValues.at(0).GetValue<int>();
+    int id = returnValues.at(0).GetValue<int>();
+    if (id > 0)
+        Plugin::Get()->OnEntityCreated(EntityType::Door, id);
+    return id;
 }
 
-EXPORTED unsigned int GetEntityDimension(const char* entityName, int id)
+EXPORTED unsigned int GetEntityDimension(int type, int id)
 {
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(id);
-    std::string funcName = "Get" + std::string(entityName) + "Dimension";
-    Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction(funcName.c_str(), &args);
-    return returnValues.at(0).GetValue<unsigned int>();
+    static constexpr decltype(&EntityFunctions::GetDimension<EntityType::Player>) getters[] =
+            ENTITY_TYPE_TABLE(EntityFunctions::GetDimension);
+    return IsEntityType(type) ? getters[type](id) : 0;
 }
 
-EXPORTED void SetEntityDimension(const char* entityName, int id, unsigned int dim)
+EXPORTED void SetEntityDimension(int type, int id, unsigned int dim)
 {
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(id, dim);
-    std::string funcName = "Set" + std::string(entityName) + "Dimension";
-    Plugin::Get()->CallLuaFunction(funcName.c_str(), &args);
+    static constexpr decltype(&EntityFunctions::SetDimension<EntityType::Player>) setters[] =
+            ENTITY_TYPE_TABLE(EntityFunctions::SetDimension);
+    if (IsEntityType(type))
+        setters[type](id, dim);
 }
 
-EXPORTED void DestroyEntity(const char* entityName, int id)
+EXPORTED int GetDimensionMembers(unsigned int dimension, int type, int* buffer, int size)
 {
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(id);
-    std::string funcName = "Destroy" + std::string(entityName);
-    Plugin::Get()->CallLuaFunction(funcName.c_str(), &args);
+    if (!IsEntityType(type))
+        return 0;
+
+    const std::vector<int>* members = DimensionIndex::Get()->GetMembers(dimension, (EntityType) type);
+    if (members == nullptr)
+        return 0;
+
+    int count = (int) members->size();
+    if (buffer != nullptr && size > 0)
+        memcpy(buffer, members->data(), sizeof(int) * (size_t) (size < count ? size : count));
+    return count;
+}
+
+EXPORTED void GetEntityDimensions(int type, int ids[], unsigned int dimensions[], int count)
+{
+    static constexpr decltype(&EntityFunctions::GetDimension<EntityType::Player>) getters[] =
+            ENTITY_TYPE_TABLE(EntityFunctions::GetDimension);
+    if (!IsEntityType(type))
+        return;
+
+    auto getter = getters[type];
+    for (int i = 0; i < count; i++)
+        dimensions[i] = getter(ids[i]);
+}
+
+EXPORTED void DestroyEntity(int type, int id)
+{
+    static constexpr decltype(&EntityFunctions::Destroy<EntityType::Player>) destroyers[] =
+            ENTITY_TYPE_TABLE(EntityFunctions::Destroy);
+    if (IsEntityType(type))
+        destroyers[type](id);
 }
 
 EXPORTED void GetNetworkStats(int source, int* totalPacketLoss, int* lastSecondPacketLoss, int* messagesInResendBuffer,
@@ -1173,45 +1572,198 @@ EXPORTED int GetLengthOfTable(Plugin::NValue* table)
     return table->tVal->Count();
 }
 
-EXPORTED Plugin::NValue** InvokePackage(const char* importId, const char* funcName, Plugin::NValue* nVals[], int len)
+EXPORTED int ResolvePackageFunction(const char* importId, const char* funcName)
 {
-    Lua::LuaArgs_t arg_list = Lua::BuildArgumentList(importId, funcName);
-    for(int i = 0; i < len; i++)
+    lua_State* L = Plugin::Get()->GetMainState();
+    int top = lua_gettop(L);
+    lua_getglobal(L, "Onsharp_ResolvePackageFunction");
+    lua_pushstring(L, importId);
+    lua_pushstring(L, funcName);
+    if (lua_pcall(L, 2, 1, 0) != LUA_OK || lua_isnil(L, -1))
     {
-        nVals[i]->AddAsArg(&arg_list);
+        lua_settop(L, top);
+        return LUA_NOREF;
     }
 
-    Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction("Onsharp_InvokePackage", &arg_list);
-    auto rVals = new Plugin::NValue*[returnValues.size()];
-    for(int i = 0; i < static_cast<int>(returnValues.size()); i++)
+    int handle = Plugin::Get()->AddPackageFunction(importId, luaL_ref(L, LUA_REGISTRYINDEX));
+    lua_settop(L, top);
+    return handle;
+}
+
+EXPORTED int InvokePackageFunction(int handle, Plugin::NValue* nVals[], int len, Plugin::NValue* results[], int resultLen)
+{
+    // the function is gone when its package stopped, the caller resolves it again
+    int ref = Plugin::Get()->GetPackageFunction(handle);
+    if (ref == LUA_NOREF)
+        return LUA_NOREF;
+
+    lua_State* L = Plugin::Get()->GetMainState();
+    if (!lua_checkstack(L, len + 1))
     {
-        rVals[i] = Plugin::Get()->CreateNValueByLua(returnValues.at(i));
+        LogRing::Get()->Writef(LogLevel::Error, "Onsharp: no stack space for %d package function arguments", len);
+        return -1;
     }
 
-    return rVals;
+    int top = lua_gettop(L);
+    lua_rawgeti(L, LUA_REGISTRYINDEX, ref);
+    for (int i = 0; i < len; i++)
+    {
+        nVals[i]->PushToLua(L);
+    }
+
+    if (lua_pcall(L, len, LUA_MULTRET, 0) != LUA_OK)
+    {
+        LogRing::Get()->Writef(LogLevel::Error, "Onsharp: package function call failed: %s", lua_tostring(L, -1));
+        lua_settop(L, top);
+        return -1;
+    }
+
+    int count = lua_gettop(L) - top;
+    for (int i = 0; i < count && i < resultLen; i++)
+    {
+        results[i] = Plugin::Get()->CreateNValueByStack(L, top + 1 + i);
+    }
+
+    lua_settop(L, top);
+    return count;
 }
 
-EXPORTED void ImportPackage(const char* packageName)
+EXPORTED void ImportPackage(const char* importId, const char* packageName)
 {
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(packageName);
+    Plugin::Get()->AddImportedPackage(importId, packageName);
+    Lua::LuaArgs_t args = Lua::BuildArgumentList(importId, packageName);
     Plugin::Get()->CallLuaFunction("Onsharp_ImportPackage", &args);
 }
 
-EXPORTED void GetEntityPosition(int id, const char* entityName, double* x, double* y, double* z)
+EXPORTED void GetEntityPosition(int id, int type, double* x, double* y, double* z)
 {
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(id);
-    std::string funcName = "Get" + std::string(entityName) + "Location";
-    Lua::LuaArgs_t returnVals = Plugin::Get()->CallLuaFunction(funcName.c_str(), &args);
-    *x = returnVals.at(0).GetValue<double>();
-    *y = returnVals.at(1).GetValue<double>();
-    *z = returnVals.at(2).GetValue<double>();
+    static constexpr decltype(&EntityFunctions::GetPosition<EntityType::Player>) getters[] =
+            ENTITY_TYPE_TABLE(EntityFunctions::GetPosition);
+    if (IsEntityType(type))
+        getters[type](id, x, y, z);
 }
 
-EXPORTED void SetEntityPosition(int id, const char* entityName, double x, double y, double z)
+EXPORTED void SetEntityPosition(int id, int type, double x, double y, double z)
 {
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(id, x, y, z);
-    std::string funcName = "Set" + std::string(entityName) + "Location";
-    Plugin::Get()->CallLuaFunction(funcName.c_str(), &args);
+    static constexpr decltype(&EntityFunctions::SetPosition<EntityType::Player>) setters[] =
+            ENTITY_TYPE_TABLE(EntityFunctions::SetPosition);
+    if (IsEntityType(type))
+        setters[type](id, x, y, z);
+}
+
+static int WriteSpatialHits(const std::vector<SpatialIndex::Hit>& hits, int* ids, int* types, double* distances, int size)
+{
+    int count = (int) hits.size();
+    for (int i = 0; i < count && i < size; i++)
+    {
+        ids[i] = hits[i].id;
+        if (types != nullptr)
+            types[i] = (int) hits[i].type;
+        if (distances != nullptr)
+            distances[i] = hits[i].distance;
+    }
+    return count;
+}
+
+EXPORTED int ComputeDistanceMask(const float* xs, const float* ys, const float* zs, int count, float px, float py,
+        float pz, float radius, uint8_t* mask)
+{
+    return Simd::DistanceMask(xs, ys, zs, count, px, py, pz, radius, mask);
+}
+
+EXPORTED int ComputePairsWithinRadius(const float* xs, const float* ys, const float* zs, int count, float radius,
+        int* first, int* second, int maxPairs)
+{
+    return Simd::PairsWithinRadius(xs, ys, zs, count, radius, first, second, maxPairs);
+}
+
+EXPORTED int QueryEntitiesInRadius(unsigned int dimension, double x, double y, double z, double radius, int typeMask,
+        int* ids, int* types, int size)
+{
+    std::vector<SpatialIndex::Hit> hits;
+    SpatialIndex::Get()->QueryRadius(dimension, x, y, z, radius, typeMask, hits);
+    return WriteSpatialHits(hits, ids, types, nullptr, size);
+}
+
+EXPORTED int QueryEntitiesInBox(unsigned int dimension, double minX, double minY, double minZ, double maxX, double maxY,
+        double maxZ, int typeMask, int* ids, int* types, int size)
+{
+    std::vector<SpatialIndex::Hit> hits;
+    SpatialIndex::Get()->QueryBox(dimension, minX, minY, minZ, maxX, maxY, maxZ, typeMask, hits);
+    return WriteSpatialHits(hits, ids, types, nullptr, size);
+}
+
+EXPORTED int QueryNearestEntities(unsigned int dimension, double x, double y, double z, int typeMask, int k,
+        int* ids, int* types, double* distances)
+{
+    std::vector<SpatialIndex::Hit> hits;
+    SpatialIndex::Get()->QueryNearest(dimension, x, y, z, typeMask, k, hits);
+    return WriteSpatialHits(hits, ids, types, distances, k);
+}
+
+EXPORTED void ConfigureNetworkSampler(float interval, int spreadTicks)
+{
+    NetStatsSampler::Get()->Configure(interval, spreadTicks);
+}
+
+EXPORTED int GetNetworkStatsAggregate(int source, int field, int window, double* min, double* max, double* avg, double* p95)
+{
+    return NetStatsSampler::Get()->Aggregate(source, field, window, min, max, avg, p95);
+}
+
+EXPORTED int RegisterLogSink(const char* directory)
+{
+    return LogRing::Get()->RegisterSink(directory);
+}
+
+EXPORTED bool WriteLog(int sink, int level, bool toConsole, const char* text)
+{
+    return LogRing::Get()->Write(sink, (LogLevel) level, toConsole, text, strlen(text));
+}
+
+EXPORTED int RegisterLogSinkUtf8(const char* directory, int length)
+{
+    return LogRing::Get()->RegisterSink(std::string(directory, length > 0 ? (size_t) length : 0));
+}
+
+EXPORTED bool WriteLogUtf8(int sink, int level, bool toConsole, const char* text, int length)
+{
+    return LogRing::Get()->Write(sink, (LogLevel) level, toConsole, text, length > 0 ? (size_t) length : 0);
+}
+
+EXPORTED long long GetDroppedLogCount()
+{
+    return (long long) LogRing::Get()->GetDropped();
+}
+
+EXPORTED bool StartTrace(int seconds)
+{
+    return TraceRecorder::Get()->Start(seconds);
+}
+
+EXPORTED bool IsTraceActive()
+{
+    return TraceRecorder::Get()->IsActive();
+}
+
+EXPORTED bool TraceBegin(const char* name)
+{
+    return TraceRecorder::Get()->Record('B', TraceCategory::Managed, name);
+}
+
+EXPORTED void TraceEnd(const char* name)
+{
+    TraceRecorder::Get()->Record('E', TraceCategory::Managed, name);
+}
+
+EXPORTED void ConfigureTickMonitor(double thresholdMs)
+{
+    TickMonitor::Get()->Configure(thresholdMs);
+}
+
+EXPORTED int GetTickHistogram(int* counts, int capacity)
+{
+    return TickMonitor::Get()->GetHistogram(counts, capacity);
 }
 
 EXPORTED void ShutdownServer()
@@ -1226,16 +1778,18 @@ EXPORTED void RegisterRemoteEvent(const char* pluginId, const char* eventName)
     Plugin::Get()->CallLuaFunction("Onsharp_RegisterRemoteEvent", &args);
 }
 
-EXPORTED void RegisterCommand(const char* pluginId, const char* commandName)
+EXPORTED int RegisterCommand(const char* commandName)
 {
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(pluginId, commandName);
+    int handle = Plugin::Get()->NextCommandHandle();
+    Lua::LuaArgs_t args = Lua::BuildArgumentList(handle, commandName);
     Plugin::Get()->CallLuaFunction("Onsharp_RegisterCommand", &args);
+    return handle;
 }
 
-EXPORTED void RegisterCommandAlias(const char* pluginId, const char* commandName, const char* alias)
+EXPORTED void RegisterCommandAlias(int handle, const char* alias)
 {
-    Lua::LuaArgs_t args = Lua::BuildArgumentList(pluginId, commandName, alias);
-    Plugin::Get()->CallLuaFunction("Onsharp_RegisterCommandAlias", &args);
+    Lua::LuaArgs_t args = Lua::BuildArgumentList(handle, alias);
+    Plugin::Get()->CallLuaFunction("Onsharp_RegisterCommand", &args);
 }
 
 EXPORTED Plugin::NValue* CreateNValue_s(const char* val)
@@ -1314,12 +1868,26 @@ EXPORTED Plugin::NTYPE GetNType(Plugin::NValue* nPtr)
     return nPtr->type;
 }
 
-EXPORTED bool IsEntityValid(int id, const char* entityName)
+EXPORTED bool IsEntityValid(int id, int type)
 {
-    std::string sFuncName = "IsValid" + std::string(entityName);
-    Lua::LuaArgs_t argValues = Lua::BuildArgumentList(id);
-    Lua::LuaArgs_t returnValues = Plugin::Get()->CallLuaFunction(sFuncName.c_str(), &argValues);
-    return returnValues.at(0).GetValue<bool>();
+    static constexpr decltype(&EntityFunctions::IsValid<EntityType::Player>) checks[] =
+            ENTITY_TYPE_TABLE(EntityFunctions::IsValid);
+    return IsEntityType(type) && checks[type](id);
+}
+
+EXPORTED int GetEntityCount(int type)
+{
+    return IsEntityType(type) ? EntityRegistry::Get()->Count((EntityType) type) : 0;
+}
+
+EXPORTED int GetEntities(int type, int* buffer, int size)
+{
+    return IsEntityType(type) ? EntityRegistry::Get()->Enumerate((EntityType) type, buffer, size) : 0;
+}
+
+EXPORTED unsigned int GetEntityGeneration(int id, int type)
+{
+    return IsEntityType(type) ? EntityRegistry::Get()->GetGeneration((EntityType) type, id) : 0;
 }
 
 EXPORTED void CallRemote(int player, const char* name, Plugin::NValue* nVals[], int len)
@@ -1333,4 +1901,538 @@ EXPORTED void CallRemote(int player, const char* name, Plugin::NValue* nVals[],
     Plugin::Get()->CallLuaFunction("CallRemoteEvent", &arg_list);
 }
 
-//endregion
\ No newline at end of file
+EXPORTED void QueueRemote(int player, const char* name, Plugin::NValue* nVals[], int len, bool state)
+{
+    RemoteBatch::Get()->Queue(player, name, nVals, len, state);
+}
+
+EXPORTED void CallRemoteMulticast(int players[], int count, const char* name, Plugin::NValue* nVals[], int len)
+{
+    Plugin::Get()->CallRemoteEvents(players, count, { name, (int) strlen(name) }, nVals, len);
+}
+
+EXPORTED void CallRemoteBroadcast(const char* name, Plugin::NValue* nVals[], int len)
+{
+    std::vector<int> players = Plugin::Get()->GetAllPlayers();
+    Plugin::Get()->CallRemoteEvents(players.data(), (int) players.size(), { name, (int) strlen(name) }, nVals, len);
+}
+
+EXPORTED void CallRemoteDimension(unsigned int dimension, const char* name, Plugin::NValue* nVals[], int len)
+{
+    const std::vector<int>* players = DimensionIndex::Get()->GetMembers(dimension, EntityType::Player);
+    if (players != nullptr)
+        Plugin::Get()->CallRemoteEvents(players->data(), (int) players->size(), { name, (int) strlen(name) }, nVals, len);
+}
+
+EXPORTED Plugin::NValue* CreateNValue_u8(const char* val, int length)
+{
+    auto nVal = new Plugin::NValue;
+    nVal->type = Plugin::NTYPE::STRING;
+    nVal->sVal.assign(val, length > 0 ? (size_t) length : 0);
+    return nVal;
+}
+
+EXPORTED void SetPlayerAnimationUtf8(int player, const char* animation, int length)
+{
+    Plugin::Get()->CallLuaDirect("SetPlayerAnimation", 0, player, Plugin::LuaString{ animation, length });
+}
+
+EXPORTED void KickPlayerUtf8(int player, const char* reason, int length)
+{
+    Plugin::Get()->CallLuaDirect("KickPlayer", 0, player, Plugin::LuaString{ reason, length });
+}
+
+EXPORTED void SetPlayerNameUtf8(int player, const char* name, int length)
+{
+    Plugin::Get()->CallLuaDirect("SetPlayerName", 0, player, Plugin::LuaString{ name, length });
+}
+
+EXPORTED void SendPlayerChatMessageUtf8(int player, const char* message, int length)
+{
+    Plugin::Get()->CallLuaDirect("AddPlayerChat", 0, player, Plugin::LuaString{ message, length });
+}
+
+EXPORTED void SetNPCAnimationUtf8(int npc, const char* animation, int length, bool loop)
+{
+    Plugin::Get()->CallLuaDirect("SetNPCAnimation", 0, npc, Plugin::LuaString{ animation, length }, loop);
+}
+
+EXPORTED void SetVehicleLicensePlateUtf8(int vehicle, const char* text, int length)
+{
+    Plugin::Get()->CallLuaDirect("SetVehicleLicensePlate", 0, vehicle, Plugin::LuaString{ text, length });
+}
+
+EXPORTED void SetText3DTextUtf8(int text3d, const char* text, int length)
+{
+    Plugin::Get()->CallLuaDirect("SetText3DText", 0, text3d, Plugin::LuaString{ text, length });
+}
+
+EXPORTED int CreateText3DUtf8(const char* text, int length, int size, double x, double y, double z, double rx, double ry, double rz)
+{
+    lua_State* L = Plugin::Get()->GetMainState();
+    if (!Plugin::Get()->CallLuaDirect("CreateText3D", 1, Plugin::LuaString{ text, length }, size, x, y, z, rx, ry, rz))
+        return 0;
+
+    int id = (int) lua_tointeger(L, -1);
+    lua_pop(L, 1);
+    if (id > 0)
+        Plugin::Get()->OnEntityCreated(EntityType::Text3D, id);
+    return id;
+}
+
+EXPORTED void CallRemoteUtf8(int player, const char* name, int nameLength, Plugin::NValue* nVals[], int len)
+{
+    Plugin::Get()->CallRemoteEvents(&player, 1, { name, nameLength }, nVals, len);
+}
+
+EXPORTED void CallRemoteMulticastUtf8(int players[], int count, const char* name, int nameLength, Plugin::NValue* nVals[], int len)
+{
+    Plugin::Get()->CallRemoteEvents(players, count, { name, nameLength }, nVals, len);
+}
+
+EXPORTED void CallRemoteBroadcastUtf8(const char* name, int nameLength, Plugin::NValue* nVals[], int len)
+{
+    std::vector<int> players = Plugin::Get()->GetAllPlayers();
+    Plugin::Get()->CallRemoteEvents(players.data(), (int) players.size(), { name, nameLength }, nVals, len);
+}
+
+EXPORTED void CallRemoteDimensionUtf8(unsigned int dimension, const char* name, int nameLength, Plugin::NValue* nVals[], int len)
+{
+    const std::vector<int>* players = DimensionIndex::Get()->GetMembers(dimension, EntityType::Player);
+    if (players != nullptr)
+        Plugin::Get()->CallRemoteEvents(players->data(), (int) players->size(), { name, nameLength }, nVals, len);
+}
+
+// copies the string result on top of the main state into the buffer of the caller and pops it. Returns the length of the
+// whole string, which is more than the size if the buffer is too small, or -1 if the result is no string
+static int CopyLuaStringResult(char* buffer, int size)
+{
+    lua_State* L = Plugin::Get()->GetMainState();
+    int length = -1;
+    if (lua_type(L, -1) == LUA_TSTRING)
+    {
+        size_t strLen = 0;
+        const char* str = lua_tolstring(L, -1, &strLen);
+        length = (int) strLen;
+        if (buffer != nullptr && size > 0)
+            memcpy(buffer, str, length < size ? length : size);
+    }
+    lua_pop(L, 1);
+    return length;
+}
+
+EXPORTED int GetPlayerNameUtf8(int player, char* buffer, int size)
+{
+    if (!Plugin::Get()->CallLuaDirect("GetPlayerName", 1, player))
+        return -1;
+    return CopyLuaStringResult(buffer, size);
+}
+
+EXPORTED int GetPlayerIPUtf8(int player, char* buffer, int size)
+{
+    if (!Plugin::Get()->CallLuaDirect("GetPlayerIP", 1, player))
+        return -1;
+    return CopyLuaStringResult(buffer, size);
+}
+
+EXPORTED int GetPlayerGUIDUtf8(int player, char* buffer, int size)
+{
+    if (!Plugin::Get()->CallLuaDirect("GetPlayerGUID", 1, player))
+        return -1;
+    return CopyLuaStringResult(buffer, size);
+}
+
+EXPORTED int GetPlayerLocaleUtf8(int player, char* buffer, int size)
+{
+    if (!Plugin::Get()->CallLuaDirect("GetPlayerLocale", 1, player))
+        return -1;
+    return CopyLuaStringResult(buffer, size);
+}
+
+EXPORTED int GetVehicleModelNameUtf8(int vehicle, char* buffer, int size)
+{
+    if (!Plugin::Get()->CallLuaDirect("GetVehicleModelName", 1, vehicle))
+        return -1;
+    return CopyLuaStringResult(buffer, size);
+}
+
+EXPORTED int GetVehicleLicensePlateUtf8(int vehicle, char* buffer, int size)
+{
+    if (!Plugin::Get()->CallLuaDirect("GetVehicleLicensePlate", 1, vehicle))
+        return -1;
+    return CopyLuaStringResult(buffer, size);
+}
+
+EXPORTED int GetServerNameUtf8(char* buffer, int size)
+{
+    if (!Plugin::Get()->CallLuaDirect("GetServerName", 1))
+        return -1;
+    return CopyLuaStringResult(buffer, size);
+}
+
+EXPORTED int GetGameVersionAsStringUtf8(char* buffer, int size)
+{
+    if (!Plugin::Get()->CallLuaDirect("GetGameVersionString", 1))
+        return -1;
+    return CopyLuaStringResult(buffer, size);
+}
+
+// calls the given status helper with all ids in one table and copies the flat number list it returns into the values,
+// fields per id. Returns false if the helper failed
+static bool ReadStatusValues(const char* helper, const int* ids, int count, int fields, std::vector<double>& values)
+{
+    lua_State* L = Plugin::Get()->GetMainState();
+    int top = lua_gettop(L);
+    values.assign((size_t) count * fields, 0);
+    lua_getglobal(L, helper);
+    lua_createtable(L, count, 0);
+    for (int i = 0; i < count; i++)
+    {
+        lua_pushinteger(L, ids[i]);
+        lua_rawseti(L, -2, i + 1);
+    }
+
+    if (lua_pcall(L, 1, 1, 0) != LUA_OK)
+    {
+        LogRing::Get()->Writef(LogLevel::Error, "Onsharp: %s failed: %s", helper, lua_tostring(L, -1));
+        lua_settop(L, top);
+        return false;
+    }
+
+    // without a table every status keeps its defaults and is reported as invalid
+    if (!lua_istable(L, -1))
+    {
+        LogRing::Get()->Writef(LogLevel::Error, "Onsharp: %s returned no table", helper);
+        lua_settop(L, top);
+        return true;
+    }
+
+    for (int i = 0; i < count * fields; i++)
+    {
+        lua_rawgeti(L, -1, i + 1);
+        values[i] = lua_tonumber(L, -1);
+        lua_pop(L, 1);
+    }
+    lua_settop(L, top);
+    return true;
+}
+
+EXPORTED int GetPlayerStatuses(const int* players, int count, PlayerStatus* statuses)
+{
+    static std::vector<double> values;
+    if (count <= 0 || !ReadStatusValues("Onsharp_GetPlayerStatuses", players, count, PLAYER_STATUS_FIELDS, values))
+        return 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const double* v = &values[(size_t) i * PLAYER_STATUS_FIELDS];
+        PlayerStatus& status = statuses[i];
+        status.id = players[i];
+        status.valid = (int32_t) v[0];
+        status.x = v[1];
+        status.y = v[2];
+        status.z = v[3];
+        status.heading = v[4];
+        status.health = v[5];
+        status.armor = v[6];
+        status.vehicle = (int32_t) v[7];
+        status.seat = (int32_t) v[8];
+        status.ping = (int32_t) v[9];
+        status.state = (int32_t) v[10];
+        status.movementMode = (int32_t) v[11];
+        status.dimension = 0;
+        DimensionIndex::Get()->TryGet(EntityType::Player, players[i], status.dimension);
+    }
+    return count;
+}
+
+EXPORTED int GetVehicleStatuses(const int* vehicles, int count, VehicleStatus* statuses)
+{
+    static std::vector<double> values;
+    if (count <= 0 || !ReadStatusValues("Onsharp_GetVehicleStatuses", vehicles, count, VEHICLE_STATUS_FIELDS, values))
+        return 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const double* v = &values[(size_t) i * VEHICLE_STATUS_FIELDS];
+        VehicleStatus& status = statuses[i];
+        status.id = vehicles[i];
+        status.valid = (int32_t) v[0];
+        status.x = v[1];
+        status.y = v[2];
+        status.z = v[3];
+        status.rx = v[4];
+        status.ry = v[5];
+        status.rz = v[6];
+        status.vx = v[7];
+        status.vy = v[8];
+        status.vz = v[9];
+        status.heading = v[10];
+        status.health = v[11];
+        status.model = (int32_t) v[12];
+        status.driver = (int32_t) v[13];
+        status.engine = (int32_t) v[14];
+        status.gear = (int32_t) v[15];
+        status.light = (int32_t) v[16];
+        status.dimension = 0;
+        DimensionIndex::Get()->TryGet(EntityType::Vehicle, vehicles[i], status.dimension);
+    }
+    return count;
+}
+
+EXPORTED int GetNPCStatuses(const int* npcs, int count, NPCStatus* statuses)
+{
+    static std::vector<double> values;
+    if (count <= 0 || !ReadStatusValues("Onsharp_GetNPCStatuses", npcs, count, NPC_STATUS_FIELDS, values))
+        return 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const double* v = &values[(size_t) i * NPC_STATUS_FIELDS];
+        NPCStatus& status = statuses[i];
+        status.id = npcs[i];
+        status.valid = (int32_t) v[0];
+        status.x = v[1];
+        status.y = v[2];
+        status.z = v[3];
+        status.heading = v[4];
+        status.health = v[5];
+        status.dimension = 0;
+        status.reserved = 0;
+        DimensionIndex::Get()->TryGet(EntityType::NPC, npcs[i], status.dimension);
+    }
+    return count;
+}
+
+EXPORTED int LoadWorldLayoutUtf8(const char* path, int length, unsigned int dimension, int perTick)
+{
+    return WorldLoader::Get()->Load(std::string(path, length > 0 ? (size_t) length : 0), dimension, perTick);
+}
+
+EXPORTED int GetWorldLayoutIds(int layout, int* ids, int* types, int size)
+{
+    return WorldLoader::Get()->GetIds(layout, ids, types, size);
+}
+
+EXPORTED void ReleaseWorldLayout(int layout)
+{
+    WorldLoader::Get()->Release(layout);
+}
+
+EXPORTED int OpenStoreUtf8(const char* path, int length)
+{
+    return KvStoreRegistry::Get()->Open(std::string(path, length > 0 ? (size_t) length : 0));
+}
+
+EXPORTED bool CloseStore(int store)
+{
+    return KvStoreRegistry::Get()->Close(store);
+}
+
+EXPORTED void PutStoreValue(int store, const char* key, int keyLength, const char* value, int valueLength)
+{
+    std::shared_ptr<KvStore> kv = KvStoreRegistry::Get()->Find(store);
+    if (kv != nullptr)
+        kv->Put(key, keyLength, value, valueLength, false);
+}
+
+EXPORTED void RemoveStoreValue(int store, const char* key, int keyLength)
+{
+    std::shared_ptr<KvStore> kv = KvStoreRegistry::Get()->Find(store);
+    if (kv != nullptr)
+        kv->Put(key, keyLength, nullptr, 0, true);
+}
+
+EXPORTED int GetStoreValue(int store, const char* key, int keyLength, char* buffer, int size)
+{
+    std::shared_ptr<KvStore> kv = KvStoreRegistry::Get()->Find(store);
+    return kv != nullptr ? kv->Get(key, keyLength, buffer, size) : -1;
+}
+
+EXPORTED int GetStoreCount(int store)
+{
+    std::shared_ptr<KvStore> kv = KvStoreRegistry::Get()->Find(store);
+    return kv != nullptr ? kv->Count() : 0;
+}
+
+EXPORTED bool FlushStore(int store)
+{
+    std::shared_ptr<KvStore> kv = KvStoreRegistry::Get()->Find(store);
+    return kv == nullptr || kv->Flush();
+}
+
+EXPORTED void ConfigureWorldSnapshots(float interval)
+{
+    WorldSnapshot::Get()->Configure(interval);
+}
+
+EXPORTED int RestoreWorldSnapshot(int perTick)
+{
+    return WorldSnapshot::Get()->Restore(perTick);
+}
+
+EXPORTED void SetEntityPersistent(int type, int id, bool persistent)
+{
+    if (IsEntityType(type))
+        WorldSnapshot::Get()->SetPersistent((EntityType) type, id, persistent);
+}
+
+static std::string MakeString(const char* text, int length)
+{
+    return std::string(text, length > 0 ? (size_t) length : 0);
+}
+
+EXPORTED const NativeApi* StartBridgeRecordingUtf8(const char* path, int length, long long maxBytes)
+{
+    const NativeApi* api = GetNativeApi();
+    if (!BridgeRecorder::Get()->Start(MakeString(path, length), GetNativeApiNames(), api->count,
+                                      maxBytes > 0 ? (uint64_t) maxBytes : 0))
+        return nullptr;
+    return GetRecordingNativeApi();
+}
+
+EXPORTED bool StopBridgeRecording()
+{
+    return BridgeRecorder::Get()->Stop();
+}
+
+EXPORTED Plugin::NValue* GetPropertyValueUtf8(int type, int entity, const char* propertyKey, int length)
+{
+    return GetPropertyValue(type, entity, MakeString(propertyKey, length).c_str());
+}
+
+EXPORTED void SetPropertyValueUtf8(int type, int entity, const char* propertyKey, int length,
+                                   Plugin::NValue* propertyValue, bool sync)
+{
+    SetPropertyValue(type, entity, MakeString(propertyKey, length).c_str(), propertyValue, sync);
+}
+
+EXPORTED bool SetPlayerWeaponStatUtf8(int player, int weapon, const char* stat, int length, double value)
+{
+    return SetPlayerWeaponStat(player, weapon, MakeString(stat, length).c_str(), value);
+}
+
+EXPORTED void SetVehicleColorUtf8(int vehicle, const char* hexColor, int length)
+{
+    SetVehicleColor(vehicle, MakeString(hexColor, length).c_str());
+}
+
+EXPORTED void SetText3DAttachedUtf8(int text3d, int attachType, int entity, double x, double y, double z,
+                                    double rx, double ry, double rz, const char* socketName, int length)
+{
+    SetText3DAttached(text3d, attachType, entity, x, y, z, rx, ry, rz, MakeString(socketName, length).c_str());
+}
+
+EXPORTED void SetObjectAttachedUtf8(int obj, int attachType, int entity, double x, double y, double z,
+                                    double rx, double ry, double rz, const char* socketName, int length)
+{
+    SetObjectAttached(obj, attachType, entity, x, y, z, rx, ry, rz, MakeString(socketName, length).c_str());
+}
+
+EXPORTED int CreateTimerUtf8(const char* id, int length, double interval)
+{
+    return CreateTimer(MakeString(id, length).c_str(), interval);
+}
+
+EXPORTED void DelayUtf8(const char* id, int length, long long millis)
+{
+    Delay(MakeString(id, length).c_str(), millis);
+}
+
+EXPORTED void SetServerNameUtf8(const char* name, int length)
+{
+    SetServerName(MakeString(name, length).c_str());
+}
+
+EXPORTED bool IsPackageStartedUtf8(const char* name, int length)
+{
+    return IsPackageStarted(MakeString(name, length).c_str());
+}
+
+EXPORTED void StopPackageUtf8(const char* name, int length)
+{
+    StopPackage(MakeString(name, length).c_str());
+}
+
+EXPORTED void StartPackageUtf8(const char* name, int length)
+{
+    StartPackage(MakeString(name, length).c_str());
+}
+
+EXPORTED int ResolvePackageFunctionUtf8(const char* importId, int importLength, const char* funcName, int funcLength)
+{
+    return ResolvePackageFunction(MakeString(importId, importLength).c_str(), MakeString(funcName, funcLength).c_str());
+}
+
+EXPORTED void ImportPackageUtf8(const char* importId, int importLength, const char* packageName, int packageLength)
+{
+    ImportPackage(MakeString(importId, importLength).c_str(), MakeString(packageName, packageLength).c_str());
+}
+
+EXPORTED void RegisterRemoteEventUtf8(const char* pluginId, int pluginLength, const char* eventName, int eventLength)
+{
+    RegisterRemoteEvent(MakeString(pluginId, pluginLength).c_str(), MakeString(eventName, eventLength).c_str());
+}
+
+EXPORTED int RegisterCommandUtf8(const char* commandName, int length)
+{
+    return RegisterCommand(MakeString(commandName, length).c_str());
+}
+
+EXPORTED void RegisterCommandAliasUtf8(int handle, const char* alias, int length)
+{
+    RegisterCommandAlias(handle, MakeString(alias, length).c_str());
+}
+
+EXPORTED void QueueRemoteUtf8(int player, const char* name, int length, Plugin::NValue* nVals[], int len, bool state)
+{
+    QueueRemote(player, MakeString(name, length).c_str(), nVals, len, state);
+}
+
+//endregion
+
+//region Native Api Table
+
+#define NATIVE_API_ENTRY(name) (void*) &name,
+static void* const NativeApiFunctions[] = { NATIVE_API_FUNCTIONS(NATIVE_API_ENTRY) };
+#undef NATIVE_API_ENTRY
+
+const NativeApi* GetNativeApi()
+{
+    static const NativeApi api = { NATIVE_API_VERSION, (int) (sizeof(NativeApiFunctions) / sizeof(void*)), NativeApiFunctions };
+    return &api;
+}
+
+#define NATIVE_API_INDEX(name) NativeApiIndex_##name,
+enum NativeApiIndex { NATIVE_API_FUNCTIONS(NATIVE_API_INDEX) NativeApiCount };
+#undef NATIVE_API_INDEX
+
+#define NATIVE_API_NAME(name) #name,
+static const char* const NativeApiNames[] = { NATIVE_API_FUNCTIONS(NATIVE_API_NAME) };
+#undef NATIVE_API_NAME
+
+#define NATIVE_API_RECORDED(name) (void*) &RecordedExport<&name, NativeApiIndex_##name>::Call,
+static void* const NativeApiRecorded[] = { NATIVE_API_FUNCTIONS(NATIVE_API_RECORDED) };
+#undef NATIVE_API_RECORDED
+
+#define NATIVE_API_REPLAYER(name) &RecordedExport<&name, NativeApiIndex_##name>::Replay,
+static const BridgeReplayer_t NativeApiReplayers[] = { NATIVE_API_FUNCTIONS(NATIVE_API_REPLAYER) };
+#undef NATIVE_API_REPLAYER
+
+const NativeApi* GetRecordingNativeApi()
+{
+    static const NativeApi api = { NATIVE_API_VERSION, NativeApiCount, NativeApiRecorded };
+    return &api;
+}
+
+const char* const* GetNativeApiNames()
+{
+    return NativeApiNames;
+}
+
+const BridgeReplayer_t* GetNativeApiReplayers()
+{
+    return NativeApiReplayers;
+}
+
+//endregion
@@ -3,10 +3,16 @@
 #include <vector>
 #include <tuple>
 #include <map>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <PluginSDK.h>
 #include "Singleton.hpp"
 #include "NetBridge.hpp"
+#include "EntityType.hpp"
+#include "LogRing.hpp"
+#include "TraceRecorder.hpp"
+#include "BridgeRecorder.hpp"
 
 class Plugin : public Singleton<Plugin>
 {
@@ -17,7 +23,17 @@ private:
     std::map<std::string, lua_State*> packageStates;
     std::map<lua_State*, std::string> statePackages;
     NetBridge bridge;
-    lua_State* MainScriptVM;
+    lua_State* MainScriptVM = nullptr;
+    int commandHandles = 0;
+    // the handles of the resolved package functions are never reused, a stale handle cannot call another function
+    struct PackageFunction
+    {
+        int ref;
+        std::string packageName;
+    };
+    std::map<std::string, std::string> importedPackages;
+    std::map<int, PackageFunction> packageFunctions;
+    int packageFunctionHandles = 0;
 
 private:
     using FuncInfo_t = std::tuple<const char *, lua_CFunction>;
@@ -112,33 +128,58 @@ public:
             return new Lua::LuaValue();
         }
 
+        void PushToLua(lua_State* L) const
+        {
+            switch (type)
+            {
+                case NTYPE::STRING:
+                    lua_pushlstring(L, sVal.c_str(), sVal.size());
+                    break;
+                case NTYPE::INTEGER:
+                    lua_pushinteger(L, iVal);
+                    break;
+                case NTYPE::DOUBLE:
+                    lua_pushnumber(L, dVal);
+                    break;
+                case NTYPE::BOOLEAN:
+                    lua_pushboolean(L, bVal);
+                    break;
+                case NTYPE::TABLE:
+                    Lua::PushValueToLua(Lua::LuaValue(tVal), L);
+                    break;
+                default:
+                    lua_pushnil(L);
+                    break;
+            }
+        }
+
         void Debug() const
         {
             if(type == NTYPE::STRING)
             {
-                Onset::Plugin::Get()->Log("nval STR : %s \n", sVal.c_str());
+                LogRing::Get()->Writef(LogLevel::Debug, "nval STR : %s", sVal.c_str());
                 return;
             }
 
             if(type == NTYPE::INTEGER)
             {
-                Onset::Plugin::Get()->Log("nval INT : %d \n", iVal);
+                LogRing::Get()->Writef(LogLevel::Debug, "nval INT : %d", iVal);
                 return;
             }
 
             if(type == NTYPE::DOUBLE)
             {
-                Onset::Plugin::Get()->Log("nval DBL : %f \n", dVal);
+                LogRing::Get()->Writef(LogLevel::Debug, "nval DBL : %f", dVal);
                 return;
             }
 
             if(type == NTYPE::BOOLEAN)
             {
-                Onset::Plugin::Get()->Log("nval BLD : %s \n", bVal ? "true" : "false");
+                LogRing::Get()->Writef(LogLevel::Debug, "nval BLD : %s", bVal ? "true" : "false");
                 return;
             }
 
-            Onset::Plugin::Get()->Log("nval NULL\n");
+            LogRing::Get()->Writef(LogLevel::Debug, "nval NULL");
         }
     };
 
@@ -146,19 +187,61 @@ public:
     {
         return _func_list;
     }
-    void AddPackage(std::string name, lua_State* state) {
+    void AddPackage(const std::string& name, lua_State* state) {
         this->packageStates[name] = state;
         this->statePackages[state] = name;
     }
-    void RemovePackage(std::string name) {
-        this->statePackages[this->packageStates[name]] = nullptr;
-        this->packageStates[name] = nullptr;
+    void RemovePackage(const std::string& name) {
+        ReleasePackageFunctions(name == "onsharp" ? std::string() : name);
+        // the state is closed after the unload, the tick work skips the Lua calls while there is none
+        if (name == "onsharp")
+            this->MainScriptVM = nullptr;
+        auto it = this->packageStates.find(name);
+        if (it == this->packageStates.end()) return;
+        this->statePackages.erase(it->second);
+        this->packageStates.erase(it);
+    }
+    void AddImportedPackage(const std::string& importId, const std::string& packageName) {
+        this->importedPackages[importId] = packageName;
+    }
+    int AddPackageFunction(const std::string& importId, int ref) {
+        auto it = this->importedPackages.find(importId);
+        int handle = ++this->packageFunctionHandles;
+        this->packageFunctions[handle] = { ref, it == this->importedPackages.end() ? importId : it->second };
+        return handle;
+    }
+    int GetPackageFunction(int handle) {
+        auto it = this->packageFunctions.find(handle);
+        return it == this->packageFunctions.end() ? LUA_NOREF : it->second.ref;
+    }
+    // Releases the registry references of the functions resolved from the given package, all of them if it is empty.
+    void ReleasePackageFunctions(const std::string& packageName) {
+        for (auto it = this->packageFunctions.begin(); it != this->packageFunctions.end();)
+        {
+            if (!packageName.empty() && it->second.packageName != packageName)
+            {
+                ++it;
+                continue;
+            }
+
+            if (this->MainScriptVM != nullptr)
+                luaL_unref(this->MainScriptVM, LUA_REGISTRYINDEX, it->second.ref);
+            it = this->packageFunctions.erase(it);
+        }
     }
-    lua_State* GetPackageState(std::string name) {
-        return this->packageStates[name];
+    lua_State* GetPackageState(const std::string& name) {
+        auto it = this->packageStates.find(name);
+        return it == this->packageStates.end() ? nullptr : it->second;
     }
     std::string GetStatePackage(lua_State* L) {
-        return this->statePackages[L];
+        auto it = this->statePackages.find(L);
+        return it == this->statePackages.end() ? std::string() : it->second;
+    }
+    lua_State* GetMainState() {
+        return this->MainScriptVM;
+    }
+    int NextCommandHandle() {
+        return ++this->commandHandles;
     }
     void Setup(lua_State* L) {
         this->MainScriptVM = L;
@@ -168,9 +251,26 @@ public:
     }
     Plugin::NValue* CallBridge(const char* key, void** args, int len)
     {
+        int eventType = -1;
+        if (len > 0 && strcmp(key, "call-event") == 0)
+            eventType = ((NValue*) args[0])->iVal;
+        if (BridgeRecorder::Get()->IsRecording())
+            BridgeRecorder::Get()->RecordCall(key, (NValue**) args, len);
+        TraceScope scope(TraceCategory::Bridge, key, eventType);
         return (Plugin::NValue*) this->bridge.CallBridge(key, args, len);
     }
-    NetBridge GetBridge() {
+    // Calls the typed callback of an event with a fast path. While recording, the event is recorded like the generic
+    // bridge call of it, with the arguments from the given stack range.
+    template<typename Call>
+    auto CallTypedEvent(int eventType, lua_State* L, int first, int count, Call call)
+    {
+        if (BridgeRecorder::Get()->IsRecording())
+            RecordTypedEvent(eventType, L, first, count);
+        TraceScope scope(TraceCategory::Bridge, "call-event", eventType);
+        return call(this->bridge);
+    }
+    void RecordTypedEvent(int eventType, lua_State* L, int first, int count);
+    NetBridge& GetBridge() {
         return this->bridge;
     }
     NValue* CreatNValueByString(std::string val){
@@ -227,6 +327,136 @@ public:
         nVal->type = NTYPE::NONE;
         return nVal;
     }
+    // a Lua number is an integer when it is one and fits into an int, everything else is a double
+    static bool ReadLuaInteger(lua_State* L, int idx, int& value)
+    {
+        if (!lua_isinteger(L, idx))
+            return false;
+
+        lua_Integer val = lua_tointeger(L, idx);
+        if (val < INT32_MIN || val > INT32_MAX)
+            return false;
+
+        value = static_cast<int>(val);
+        return true;
+    }
+    Lua::LuaValue ReadLuaValue(lua_State* L, int idx)
+    {
+        switch (lua_type(L, idx))
+        {
+            case LUA_TSTRING:
+            {
+                size_t len = 0;
+                const char* str = lua_tolstring(L, idx, &len);
+                return Lua::LuaValue(std::string(str, len));
+            }
+            case LUA_TBOOLEAN:
+                return Lua::LuaValue(lua_toboolean(L, idx) != 0);
+            case LUA_TNUMBER:
+            {
+                int val = 0;
+                if (ReadLuaInteger(L, idx, val))
+                    return Lua::LuaValue(val);
+                return Lua::LuaValue(static_cast<double>(lua_tonumber(L, idx)));
+            }
+            case LUA_TTABLE:
+                return Lua::LuaValue(ReadLuaTable(L, idx));
+            default:
+                return Lua::LuaValue();
+        }
+    }
+    Lua::LuaTable_t ReadLuaTable(lua_State* L, int idx)
+    {
+        idx = lua_absindex(L, idx);
+        Lua::LuaTable_t table(new Lua::LuaTable);
+        lua_pushnil(L);
+        while (lua_next(L, idx) != 0)
+        {
+            table->Add(ReadLuaValue(L, -2), ReadLuaValue(L, -1));
+            lua_pop(L, 1);
+        }
+        return table;
+    }
+    NValue* CreateNValueByStack(lua_State* L, int idx)
+    {
+        NValue* nVal = new NValue;
+        switch (lua_type(L, idx))
+        {
+            case LUA_TSTRING:
+            {
+                size_t len = 0;
+                const char* str = lua_tolstring(L, idx, &len);
+                nVal->type = NTYPE::STRING;
+                nVal->sVal.assign(str, len);
+                break;
+            }
+            case LUA_TBOOLEAN:
+                nVal->type = NTYPE::BOOLEAN;
+                nVal->bVal = lua_toboolean(L, idx) != 0;
+                break;
+            case LUA_TNUMBER:
+                if (ReadLuaInteger(L, idx, nVal->iVal))
+                {
+                    nVal->type = NTYPE::INTEGER;
+                }
+                else
+                {
+                    nVal->type = NTYPE::DOUBLE;
+                    nVal->dVal = lua_tonumber(L, idx);
+                }
+                break;
+            case LUA_TTABLE:
+                nVal->type = NTYPE::TABLE;
+                nVal->tVal = ReadLuaTable(L, idx);
+                break;
+            default:
+                nVal->type = NTYPE::NONE;
+                break;
+        }
+        return nVal;
+    }
+    // an utf-8 string given by pointer and length, it is pushed to lua as it is without being copied or measured
+    struct LuaString
+    {
+        const char* data;
+        int length;
+    };
+    static void PushDirect(lua_State* L, int val) { lua_pushinteger(L, val); }
+    static void PushDirect(lua_State* L, uint32_t val) { lua_pushinteger(L, (lua_Integer) val); }
+    static void PushDirect(lua_State* L, double val) { lua_pushnumber(L, val); }
+    static void PushDirect(lua_State* L, bool val) { lua_pushboolean(L, val); }
+    static void PushDirect(lua_State* L, LuaString val) { lua_pushlstring(L, val.data, val.length > 0 ? (size_t) val.length : 0); }
+    // calls the global lua function with the arguments pushed directly onto the stack of the main state, skipping the
+    // argument lists. The results are left on the stack and have to be popped by the caller, false if the call failed
+    template<typename... A>
+    bool CallLuaDirect(const char* LuaFunctionName, int results, A... args)
+    {
+        TraceScope scope(TraceCategory::Lua, LuaFunctionName);
+        lua_State* L = this->MainScriptVM;
+        lua_getglobal(L, LuaFunctionName);
+        (PushDirect(L, args), ...);
+        if (lua_pcall(L, (int) sizeof...(A), results, 0) != LUA_OK)
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: lua function %s failed: %s", LuaFunctionName, lua_tostring(L, -1));
+            lua_pop(L, 1);
+            return false;
+        }
+        return true;
+    }
     Lua::LuaArgs_t CallLuaFunction(const char* LuaFunctionName, Lua::LuaArgs_t* Arguments);
+    Lua::LuaArgs_t CallLuaFunction(lua_State* L, const char* LuaFunctionName, Lua::LuaArgs_t* Arguments);
     void ClearLuaStack();
-};
\ No newline at end of file
+    void ClearLuaStack(lua_State* L);
+    void ObserveEvent(int type, NValue* args[], int len);
+    // the destroyed entities are forgotten after the plugins handled the event, so the handlers can still read them
+    void ObserveHandledEvent(int type, NValue* args[], int len);
+    void OnEntityCreated(EntityType type, int id);
+    void OnEntityDimensionChanged(EntityType type, int id, NValue* args[], int len);
+    void SetEntityDimension(EntityType type, int id, uint32_t dimension);
+    void OnEntityDestroyed(EntityType type, int id);
+    std::vector<int> GetAllPlayers();
+    void CallRemoteEvents(const int* players, int count, LuaString name, NValue* nVals[], int len);
+};
+
+template<>
+struct IsBridgeHandle<Plugin::NValue> : std::true_type {};
\ No newline at end of file
@@ -1,8 +1,23 @@
 //
 // Created by DasDarki on 25.06.2020.
 //
+#include <cstring>
+#include <filesystem>
 #include <PluginSDK.h>
 #include "Plugin.hpp"
+#include "RemoteBatch.hpp"
+#include "PropertyStore.hpp"
+#include "EntityRegistry.hpp"
+#include "SpatialIndex.hpp"
+#include "DimensionIndex.hpp"
+#include "SimdKernels.hpp"
+#include "NetStatsSampler.hpp"
+#include "LogRing.hpp"
+#include "TraceRecorder.hpp"
+#include "WorldLoader.hpp"
+#include "KvStore.hpp"
+#include "WorldSnapshot.hpp"
+#include "BridgeRecorder.hpp"
 #include "version.hpp"
 
 Onset::IServerPlugin* Onset::Plugin::_instance = nullptr;
@@ -19,38 +34,66 @@ EXPORT(void) OnPluginCreateInterface(Onset::IBaseInterface *PluginInterface)
 
 EXPORT(int) OnPluginStart()
 {
-    Onset::Plugin::Get()->Log("OnsharpRuntime (" PLUGIN_VERSION ") loaded!");
+    TickMonitor::Get()->MarkMainThread();
+    LogRing::Get()->Start((std::filesystem::current_path() / "onsharp" / "logs" / "_native").string());
+    LogRing::Get()->Writef(LogLevel::Info, "OnsharpRuntime (" PLUGIN_VERSION ") loaded!");
+    LogRing::Get()->Writef(LogLevel::Info, "OnsharpRuntime uses the %s distance kernels", Simd::GetLevelName(Simd::GetLevel()));
     return PLUGIN_API_VERSION;
 }
 
 EXPORT(void) OnPluginStop()
 {
+    RemoteBatch::Destroy();
+    PropertyStore::Destroy();
+    EntityRegistry::Destroy();
+    SpatialIndex::Destroy();
+    DimensionIndex::Destroy();
+    NetStatsSampler::Destroy();
+    WorldSnapshot::Destroy();
+    WorldLoader::Destroy();
     Plugin::Singleton::Destroy();
+    BridgeRecorder::Destroy();
+    KvStoreRegistry::Destroy();
+    TraceRecorder::Destroy();
+    TickMonitor::Destroy();
+    LogRing::Get()->Stop();
+    LogRing::Destroy();
     Onset::Plugin::Destroy();
 }
 
 EXPORT(void) OnPluginTick(float DeltaSeconds)
 {
-    (void)DeltaSeconds;
-    Plugin::Get()->GetBridge().TriggerTick();
+    if (BridgeRecorder::Get()->IsRecording())
+        BridgeRecorder::Get()->RecordTick(DeltaSeconds);
+    {
+        TraceScope scope(TraceCategory::Tick, "OnPluginTick");
+        Plugin::Get()->GetBridge().TriggerTick();
+        WorldLoader::Get()->Tick();
+        RemoteBatch::Get()->Flush(Plugin::Get()->GetMainState(), DeltaSeconds);
+        SpatialIndex::Get()->Refresh(Plugin::Get()->GetMainState());
+        NetStatsSampler::Get()->Tick(Plugin::Get()->GetMainState(), DeltaSeconds);
+        WorldSnapshot::Get()->Tick(Plugin::Get()->GetMainState(), DeltaSeconds);
+    }
+    TraceRecorder::Get()->Poll();
 }
 
 EXPORT(void) OnPackageLoad(const char *PackageName, lua_State *L)
 {
-    auto pn = new std::string(PackageName);
-    if (*pn == "onsharp") {
+    std::string packageName(PackageName);
+    Plugin::Get()->AddPackage(packageName, L);
+    if (packageName == "onsharp") {
         for (auto const &f : Plugin::Get()->GetFunctions()){
             const char* funcName = std::get<0>(f);
-            auto stFuncName = new std::string(funcName);
-            if(*stFuncName == "CallOnsharp") continue;
+            if(strcmp(funcName, "CallOnsharp") == 0) continue;
             Lua::RegisterPluginFunction(L, funcName, std::get<1>(f));
         }
         Plugin::Get()->Setup(L);
+        EntityRegistry::Get()->Seed(L);
+        DimensionIndex::Get()->Seed(L);
     }else{
         for (auto const &f : Plugin::Get()->GetFunctions()){
             const char* funcName = std::get<0>(f);
-            auto stFuncName = new std::string(funcName);
-            if(*stFuncName != "CallOnsharp") continue;
+            if(strcmp(funcName, "CallOnsharp") != 0) continue;
             Lua::RegisterPluginFunction(L, funcName, std::get<1>(f));
             break;
         }
@@ -59,8 +102,12 @@ EXPORT(void) OnPackageLoad(const char *PackageName, lua_State *L)
 
 EXPORT(void) OnPackageUnload(const char *PackageName)
 {
-    auto pn = new std::string(PackageName);
-    if (*pn == "onsharp") {
+    std::string packageName(PackageName);
+    Plugin::Get()->RemovePackage(packageName);
+    if (packageName == "onsharp") {
         Plugin::Get()->GetBridge().Stop();
+        WorldLoader::Get()->Clear();
+        RemoteBatch::Get()->Clear();
+        WorldSnapshot::Get()->CancelCapture();
     }
 }
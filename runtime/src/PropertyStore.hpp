@@ -0,0 +1,73 @@
+#pragma once
+#ifndef __PROPERTY_STORE_H__
+#define __PROPERTY_STORE_H__
+#include <string>
+#include <cstdint>
+#include <unordered_map>
+#include "Singleton.hpp"
+#include "EntityType.hpp"
+#include "Plugin.hpp"
+
+// Holds the properties set through Onsharp without syncing them. Every key has one owner: the store while the last write
+// of Onsharp was not synced, the Lua property system of Onset otherwise. Keys which are shared with Lua packages must
+// be synced, a Lua write to a key owned by the store is not seen.
+class PropertyStore : public Singleton<PropertyStore>
+{
+    friend class Singleton<PropertyStore>;
+public:
+    using Properties_t = std::unordered_map<std::string, Plugin::NValue>;
+
+private:
+    std::unordered_map<uint64_t, Properties_t> entities;
+
+    PropertyStore() = default;
+    ~PropertyStore() = default;
+
+    static uint64_t MakeKey(EntityType type, int id)
+    {
+        return ((uint64_t) type << 32) | (uint32_t) id;
+    }
+
+public:
+    const Plugin::NValue* Find(EntityType type, int id, const char* key) const
+    {
+        auto entity = this->entities.find(MakeKey(type, id));
+        if (entity == this->entities.end())
+            return nullptr;
+
+        auto property = entity->second.find(key);
+        return property == entity->second.end() ? nullptr : &property->second;
+    }
+
+    // all properties of the entity set through Onsharp, null if there are none
+    const Properties_t* FindAll(EntityType type, int id) const
+    {
+        auto entity = this->entities.find(MakeKey(type, id));
+        return entity == this->entities.end() ? nullptr : &entity->second;
+    }
+
+    void Set(EntityType type, int id, const char* key, const Plugin::NValue& value)
+    {
+        if (value.type == Plugin::NTYPE::NONE)
+        {
+            Remove(type, id, key);
+            return;
+        }
+
+        this->entities[MakeKey(type, id)][key] = value;
+    }
+
+    void Remove(EntityType type, int id, const char* key)
+    {
+        auto entity = this->entities.find(MakeKey(type, id));
+        if (entity != this->entities.end())
+            entity->second.erase(key);
+    }
+
+    void Purge(EntityType type, int id)
+    {
+        this->entities.erase(MakeKey(type, id));
+    }
+};
+
+#endif
@@ -0,0 +1,189 @@
+#pragma once
+#ifndef __REMOTE_BATCH_H__
+#define __REMOTE_BATCH_H__
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <PluginSDK.h>
+#include "Singleton.hpp"
+#include "Plugin.hpp"
+
+#define REMOTE_BATCH_EVENT "Onsharp_RemoteBatch"
+
+// Every flushed batch carries a sequence number and is kept until the client acknowledges it. Batches which are not
+// acknowledged are sent again and dropped when they expire, the client calls every sequence once and in order.
+#define REMOTE_BATCH_RESEND 1.0
+#define REMOTE_BATCH_EXPIRY 10.0
+
+class RemoteBatch : public Singleton<RemoteBatch>
+{
+    friend class Singleton<RemoteBatch>;
+private:
+    struct Entry
+    {
+        std::string name;
+        bool state;
+        std::vector<Plugin::NValue> args;
+    };
+
+    struct Batch
+    {
+        int sequence;
+        double sentAt;
+        double resentAt;
+        std::vector<Entry> entries;
+    };
+
+    struct Channel
+    {
+        std::vector<Entry> queued;
+        std::deque<Batch> pending;
+        int nextSequence = 1;
+    };
+
+    std::unordered_map<int, Channel> channels;
+    double clock = 0;
+
+    RemoteBatch() = default;
+    ~RemoteBatch() = default;
+
+    static void RemoveState(std::vector<Entry>& entries, const char* name)
+    {
+        for (auto it = entries.begin(); it != entries.end(); ++it)
+        {
+            if (it->state && it->name == name)
+            {
+                entries.erase(it);
+                return;
+            }
+        }
+    }
+
+    // calls the batch event with { sequence, oldest pending sequence, entries }, every entry is packed as
+    // { name, argCount, args... }
+    static void Send(lua_State* L, int player, int oldest, const Batch& batch)
+    {
+        int top = lua_gettop(L);
+        lua_getglobal(L, "CallRemoteEvent");
+        lua_pushinteger(L, player);
+        lua_pushstring(L, REMOTE_BATCH_EVENT);
+        lua_pushinteger(L, batch.sequence);
+        lua_pushinteger(L, oldest);
+        lua_createtable(L, (int) batch.entries.size(), 0);
+        int idx = 1;
+        for (auto const& entry : batch.entries)
+        {
+            int argc = (int) entry.args.size();
+            lua_createtable(L, argc + 2, 0);
+            lua_pushlstring(L, entry.name.c_str(), entry.name.size());
+            lua_rawseti(L, -2, 1);
+            lua_pushinteger(L, argc);
+            lua_rawseti(L, -2, 2);
+            for (int i = 0; i < argc; i++)
+            {
+                entry.args[i].PushToLua(L);
+                lua_rawseti(L, -2, i + 3);
+            }
+            lua_rawseti(L, -2, idx++);
+        }
+
+        if (lua_pcall(L, 5, 0, 0) != LUA_OK)
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: remote batch for player %d failed: %s", player, lua_tostring(L, -1));
+        }
+        lua_settop(L, top);
+    }
+
+public:
+    // state updates replace the queued update of the same name, so only the latest one is sent. A pending batch does
+    // not send its update again once a newer one is queued.
+    void Queue(int player, const char* name, Plugin::NValue* nVals[], int len, bool state)
+    {
+        Channel& channel = this->channels[player];
+        if (state)
+        {
+            RemoveState(channel.queued, name);
+            for (Batch& batch : channel.pending)
+            {
+                RemoveState(batch.entries, name);
+            }
+        }
+
+        Entry entry;
+        entry.name = name;
+        entry.state = state;
+        entry.args.reserve(len);
+        for (int i = 0; i < len; i++)
+        {
+            entry.args.push_back(*nVals[i]);
+        }
+        channel.queued.push_back(std::move(entry));
+    }
+
+    // the client acknowledges every batch up to the given sequence
+    void Acknowledge(int player, int sequence)
+    {
+        auto it = this->channels.find(player);
+        if (it == this->channels.end())
+            return;
+
+        std::deque<Batch>& pending = it->second.pending;
+        while (!pending.empty() && pending.front().sequence <= sequence)
+        {
+            pending.pop_front();
+        }
+    }
+
+    void Drop(int player)
+    {
+        this->channels.erase(player);
+    }
+
+    // drops the queued and pending events of every player
+    void Clear()
+    {
+        this->channels.clear();
+    }
+
+    // sends the queued events of every player as one batch and sends the pending batches again which are not
+    // acknowledged in time
+    void Flush(lua_State* L, float delta)
+    {
+        this->clock += delta;
+        if (this->channels.empty() || L == nullptr)
+            return;
+
+        for (auto& p : this->channels)
+        {
+            Channel& channel = p.second;
+            while (!channel.pending.empty() && this->clock - channel.pending.front().sentAt >= REMOTE_BATCH_EXPIRY)
+            {
+                LogRing::Get()->Writef(LogLevel::Warning, "Onsharp: remote batch %d for player %d expired unacknowledged",
+                        channel.pending.front().sequence, p.first);
+                channel.pending.pop_front();
+            }
+
+            for (Batch& batch : channel.pending)
+            {
+                if (this->clock - batch.resentAt < REMOTE_BATCH_RESEND)
+                    continue;
+
+                batch.resentAt = this->clock;
+                Send(L, p.first, channel.pending.front().sequence, batch);
+            }
+
+            if (channel.queued.empty())
+                continue;
+
+            Batch& batch = channel.pending.emplace_back();
+            batch.sequence = channel.nextSequence++;
+            batch.sentAt = this->clock;
+            batch.resentAt = this->clock;
+            batch.entries.swap(channel.queued);
+            Send(L, p.first, channel.pending.front().sequence, batch);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,322 @@
+//
+// Distance kernels over SoA position arrays with a scalar, a SSE and an AVX2 path.
+//
+#include <cstring>
+#include "SimdKernels.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SIMD_TARGET_AVX2
+#endif
+
+namespace Simd
+{
+    using DistanceMask_t = int (*)(const float*, const float*, const float*, int, float, float, float, float, uint8_t*);
+    using PairsWithinRadius_t = int (*)(const float*, const float*, const float*, int, float, int*, int*, int);
+
+    static int DistanceMaskScalar(const float* xs, const float* ys, const float* zs, int count,
+                                  float px, float py, float pz, float radius, uint8_t* mask)
+    {
+        float radiusSq = radius * radius;
+        int hits = 0;
+        for (int i = 0; i < count; i++)
+        {
+            float dx = xs[i] - px, dy = ys[i] - py, dz = zs[i] - pz;
+            uint8_t hit = (dx * dx + dy * dy + dz * dz) <= radiusSq ? 1 : 0;
+            mask[i] = hit;
+            hits += hit;
+        }
+        return hits;
+    }
+
+    static int PairsFrom(const float* xs, const float* ys, const float* zs, int i, int j, int count, float radiusSq,
+                         int* first, int* second, int maxPairs, int pairs)
+    {
+        for (; j < count; j++)
+        {
+            float dx = xs[j] - xs[i], dy = ys[j] - ys[i], dz = zs[j] - zs[i];
+            if ((dx * dx + dy * dy + dz * dz) <= radiusSq)
+            {
+                if (pairs < maxPairs)
+                {
+                    first[pairs] = i;
+                    second[pairs] = j;
+                }
+                pairs++;
+            }
+        }
+        return pairs;
+    }
+
+    static int PairsWithinRadiusScalar(const float* xs, const float* ys, const float* zs, int count, float radius,
+                                       int* first, int* second, int maxPairs)
+    {
+        float radiusSq = radius * radius;
+        int pairs = 0;
+        for (int i = 0; i < count; i++)
+        {
+            pairs = PairsFrom(xs, ys, zs, i, i + 1, count, radiusSq, first, second, maxPairs, pairs);
+        }
+        return pairs;
+    }
+
+#ifdef SIMD_X86
+    static inline int CountBits(unsigned int bits)
+    {
+        int count = 0;
+        for (; bits != 0; bits &= bits - 1)
+            count++;
+        return count;
+    }
+
+    // expands the 4 bits of a compare into 4 mask bytes
+    static const uint32_t NibbleBytes[16] = {
+            0x00000000, 0x00000001, 0x00000100, 0x00000101, 0x00010000, 0x00010001, 0x00010100, 0x00010101,
+            0x01000000, 0x01000001, 0x01000100, 0x01000101, 0x01010000, 0x01010001, 0x01010100, 0x01010101
+    };
+
+    static inline void WriteMask(uint8_t* mask, unsigned int bits)
+    {
+        uint32_t bytes = NibbleBytes[bits & 0xF];
+        memcpy(mask, &bytes, sizeof(bytes));
+    }
+
+    static inline int LowestBit(unsigned int bits)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, bits);
+        return (int) index;
+#else
+        return __builtin_ctz(bits);
+#endif
+    }
+
+    static inline int EmitPairs(unsigned int bits, int i, int j, int* first, int* second, int maxPairs, int pairs)
+    {
+        for (; bits != 0; bits &= bits - 1)
+        {
+            if (pairs < maxPairs)
+            {
+                first[pairs] = i;
+                second[pairs] = j + LowestBit(bits);
+            }
+            pairs++;
+        }
+        return pairs;
+    }
+
+    static int DistanceMaskSSE(const float* xs, const float* ys, const float* zs, int count,
+                               float px, float py, float pz, float radius, uint8_t* mask)
+    {
+        const __m128 vx = _mm_set1_ps(px), vy = _mm_set1_ps(py), vz = _mm_set1_ps(pz);
+        const __m128 radiusSq = _mm_set1_ps(radius * radius);
+        int hits = 0;
+        int i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), vx);
+            __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), vy);
+            __m128 dz = _mm_sub_ps(_mm_loadu_ps(zs + i), vz);
+            __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+            unsigned int bits = (unsigned int) _mm_movemask_ps(_mm_cmple_ps(distSq, radiusSq));
+            WriteMask(mask + i, bits);
+            hits += CountBits(bits);
+        }
+        return hits + DistanceMaskScalar(xs + i, ys + i, zs + i, count - i, px, py, pz, radius, mask + i);
+    }
+
+    static int PairsWithinRadiusSSE(const float* xs, const float* ys, const float* zs, int count, float radius,
+                                    int* first, int* second, int maxPairs)
+    {
+        const float radiusSqScalar = radius * radius;
+        const __m128 radiusSq = _mm_set1_ps(radiusSqScalar);
+        int pairs = 0;
+        for (int i = 0; i < count; i++)
+        {
+            const __m128 vx = _mm_set1_ps(xs[i]), vy = _mm_set1_ps(ys[i]), vz = _mm_set1_ps(zs[i]);
+            int j = i + 1;
+            for (; j + 4 <= count; j += 4)
+            {
+                __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + j), vx);
+                __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + j), vy);
+                __m128 dz = _mm_sub_ps(_mm_loadu_ps(zs + j), vz);
+                __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+                unsigned int bits = (unsigned int) _mm_movemask_ps(_mm_cmple_ps(distSq, radiusSq));
+                pairs = EmitPairs(bits, i, j, first, second, maxPairs, pairs);
+            }
+            pairs = PairsFrom(xs, ys, zs, i, j, count, radiusSqScalar, first, second, maxPairs, pairs);
+        }
+        return pairs;
+    }
+
+    SIMD_TARGET_AVX2
+    static int DistanceMaskAVX2(const float* xs, const float* ys, const float* zs, int count,
+                                float px, float py, float pz, float radius, uint8_t* mask)
+    {
+        const __m256 vx = _mm256_set1_ps(px), vy = _mm256_set1_ps(py), vz = _mm256_set1_ps(pz);
+        const __m256 radiusSq = _mm256_set1_ps(radius * radius);
+        int hits = 0;
+        int i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), vx);
+            __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), vy);
+            __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(zs + i), vz);
+            __m256 distSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)),
+                                          _mm256_mul_ps(dz, dz));
+            unsigned int bits = (unsigned int) _mm256_movemask_ps(_mm256_cmp_ps(distSq, radiusSq, _CMP_LE_OQ));
+            WriteMask(mask + i, bits);
+            WriteMask(mask + i + 4, bits >> 4);
+            hits += CountBits(bits);
+        }
+        return hits + DistanceMaskSSE(xs + i, ys + i, zs + i, count - i, px, py, pz, radius, mask + i);
+    }
+
+    SIMD_TARGET_AVX2
+    static int PairsWithinRadiusAVX2(const float* xs, const float* ys, const float* zs, int count, float radius,
+                                     int* first, int* second, int maxPairs)
+    {
+        const __m256 radiusSq = _mm256_set1_ps(radius * radius);
+        int pairs = 0;
+        for (int i = 0; i < count; i++)
+        {
+            const __m256 vx = _mm256_set1_ps(xs[i]), vy = _mm256_set1_ps(ys[i]), vz = _mm256_set1_ps(zs[i]);
+            int j = i + 1;
+            for (; j + 8 <= count; j += 8)
+            {
+                __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + j), vx);
+                __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + j), vy);
+                __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(zs + j), vz);
+                __m256 distSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)),
+                                              _mm256_mul_ps(dz, dz));
+                unsigned int bits = (unsigned int) _mm256_movemask_ps(_mm256_cmp_ps(distSq, radiusSq, _CMP_LE_OQ));
+                pairs = EmitPairs(bits, i, j, first, second, maxPairs, pairs);
+            }
+
+            // the tail is loaded masked to stay on the AVX path
+            int rest = count - j;
+            if (rest > 0)
+            {
+                const __m256i lanes = _mm256_cmpgt_epi32(_mm256_set1_epi32(rest), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+                __m256 dx = _mm256_sub_ps(_mm256_maskload_ps(xs + j, lanes), vx);
+                __m256 dy = _mm256_sub_ps(_mm256_maskload_ps(ys + j, lanes), vy);
+                __m256 dz = _mm256_sub_ps(_mm256_maskload_ps(zs + j, lanes), vz);
+                __m256 distSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)),
+                                              _mm256_mul_ps(dz, dz));
+                unsigned int bits = (unsigned int) _mm256_movemask_ps(_mm256_cmp_ps(distSq, radiusSq, _CMP_LE_OQ));
+                pairs = EmitPairs(bits & ((1u << rest) - 1), i, j, first, second, maxPairs, pairs);
+            }
+        }
+        return pairs;
+    }
+
+    static bool SupportsAVX2()
+    {
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return false;
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+            return false;
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+
+    static Level DetectLevel()
+    {
+#ifdef SIMD_X86
+        return SupportsAVX2() ? Level::AVX2 : Level::SSE;
+#else
+        return Level::Scalar;
+#endif
+    }
+
+    static Level supportedLevel = DetectLevel();
+    static Level currentLevel = Level::Scalar;
+    static DistanceMask_t distanceMask = DistanceMaskScalar;
+    static PairsWithinRadius_t pairsWithinRadius = PairsWithinRadiusScalar;
+
+    static struct LevelInit
+    {
+        LevelInit()
+        {
+            SetLevel(supportedLevel);
+        }
+    } levelInit;
+
+    Level GetSupportedLevel()
+    {
+        return supportedLevel;
+    }
+
+    Level GetLevel()
+    {
+        return currentLevel;
+    }
+
+    void SetLevel(Level level)
+    {
+        if (level > supportedLevel)
+            level = supportedLevel;
+
+        currentLevel = level;
+        switch (level)
+        {
+#ifdef SIMD_X86
+            case Level::AVX2:
+                distanceMask = DistanceMaskAVX2;
+                pairsWithinRadius = PairsWithinRadiusAVX2;
+                break;
+            case Level::SSE:
+                distanceMask = DistanceMaskSSE;
+                pairsWithinRadius = PairsWithinRadiusSSE;
+                break;
+#endif
+            default:
+                distanceMask = DistanceMaskScalar;
+                pairsWithinRadius = PairsWithinRadiusScalar;
+                break;
+        }
+    }
+
+    const char* GetLevelName(Level level)
+    {
+        switch (level)
+        {
+            case Level::AVX2: return "AVX2";
+            case Level::SSE: return "SSE";
+            default: return "Scalar";
+        }
+    }
+
+    int DistanceMask(const float* xs, const float* ys, const float* zs, int count,
+                     float px, float py, float pz, float radius, uint8_t* mask)
+    {
+        return count <= 0 ? 0 : distanceMask(xs, ys, zs, count, px, py, pz, radius, mask);
+    }
+
+    int PairsWithinRadius(const float* xs, const float* ys, const float* zs, int count, float radius,
+                          int* first, int* second, int maxPairs)
+    {
+        return count <= 1 ? 0 : pairsWithinRadius(xs, ys, zs, count, radius, first, second, maxPairs);
+    }
+}
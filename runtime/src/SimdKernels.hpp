@@ -0,0 +1,32 @@
+#pragma once
+#ifndef __SIMD_KERNELS_H__
+#define __SIMD_KERNELS_H__
+#include <cstdint>
+
+namespace Simd
+{
+    enum class Level
+    {
+        Scalar = 0,
+        SSE = 1,
+        AVX2 = 2
+    };
+
+    // the best level supported by the running cpu, detected once
+    Level GetSupportedLevel();
+    Level GetLevel();
+    // selects the kernels of the given level, levels above the supported one are clamped
+    void SetLevel(Level level);
+    const char* GetLevelName(Level level);
+
+    // writes 1 into the mask for every position within the radius around the point, returns the count of hits
+    int DistanceMask(const float* xs, const float* ys, const float* zs, int count,
+                     float px, float py, float pz, float radius, uint8_t* mask);
+
+    // collects every pair (i < j) of positions within the radius of each other,
+    // writes at most maxPairs pairs and returns the total count of pairs
+    int PairsWithinRadius(const float* xs, const float* ys, const float* zs, int count, float radius,
+                          int* first, int* second, int maxPairs);
+}
+
+#endif
@@ -0,0 +1,399 @@
+#pragma once
+#ifndef __SPATIAL_INDEX_H__
+#define __SPATIAL_INDEX_H__
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <PluginSDK.h>
+#include "Singleton.hpp"
+#include "EntityType.hpp"
+#include "EntityRegistry.hpp"
+#include "DimensionIndex.hpp"
+#include "Plugin.hpp"
+
+#define SPATIAL_CELL_SIZE 5000.0
+#define SPATIAL_TYPE_MASK ((1 << (int) EntityType::Player) | (1 << (int) EntityType::Vehicle) | \
+    (1 << (int) EntityType::NPC) | (1 << (int) EntityType::Object) | (1 << (int) EntityType::Pickup))
+
+class SpatialIndex : public Singleton<SpatialIndex>
+{
+    friend class Singleton<SpatialIndex>;
+public:
+    struct Hit
+    {
+        EntityType type;
+        int id;
+        double distance;
+    };
+
+private:
+    struct Entry
+    {
+        EntityType type;
+        int id;
+        uint32_t dimension;
+        double x, y, z;
+        int64_t cell;
+    };
+
+    // the grid only covers the x/y plane, z is checked per entry
+    struct Grid
+    {
+        std::unordered_map<int64_t, std::vector<uint64_t>> cells;
+        int32_t minX = 0, minY = 0, maxX = 0, maxY = 0;
+    };
+
+    // the entities refreshed round robin per tick and type. Objects and pickups only move when they are told to, so
+    // they are only refreshed while they are marked as moving or when they are dirty.
+    static constexpr int RefreshBudgets[(int) EntityType::Count] = { 128, 64, 64, 0, 0, 0, 0 };
+
+    std::unordered_map<uint64_t, Entry> entries;
+    std::unordered_map<uint32_t, Grid> grids;
+    std::vector<uint64_t> dirty;
+    std::unordered_set<uint64_t> moving;
+    size_t cursors[(int) EntityType::Count] = {};
+    std::vector<int> fetches[(int) EntityType::Count];
+
+    SpatialIndex() = default;
+    ~SpatialIndex() = default;
+
+    static uint64_t MakeKey(EntityType type, int id)
+    {
+        return ((uint64_t) type << 32) | (uint32_t) id;
+    }
+
+    static int32_t ToCell(double v)
+    {
+        return (int32_t) std::floor(v / SPATIAL_CELL_SIZE);
+    }
+
+    static int64_t MakeCell(int32_t cx, int32_t cy)
+    {
+        return ((int64_t) cx << 32) | (uint32_t) cy;
+    }
+
+    void Unlink(const Entry& entry, uint64_t key)
+    {
+        auto grid = this->grids.find(entry.dimension);
+        if (grid == this->grids.end())
+            return;
+
+        auto cell = grid->second.cells.find(entry.cell);
+        if (cell == grid->second.cells.end())
+            return;
+
+        std::vector<uint64_t>& keys = cell->second;
+        auto it = std::find(keys.begin(), keys.end(), key);
+        if (it != keys.end())
+        {
+            *it = keys.back();
+            keys.pop_back();
+        }
+        if (keys.empty())
+            grid->second.cells.erase(cell);
+    }
+
+    void Link(const Entry& entry, uint64_t key)
+    {
+        auto found = this->grids.find(entry.dimension);
+        int32_t cx = ToCell(entry.x), cy = ToCell(entry.y);
+        if (found == this->grids.end())
+        {
+            Grid& grid = this->grids[entry.dimension];
+            grid.minX = grid.maxX = cx;
+            grid.minY = grid.maxY = cy;
+            grid.cells[entry.cell].push_back(key);
+            return;
+        }
+
+        Grid& grid = found->second;
+        grid.minX = std::min(grid.minX, cx);
+        grid.maxX = std::max(grid.maxX, cx);
+        grid.minY = std::min(grid.minY, cy);
+        grid.maxY = std::max(grid.maxY, cy);
+        grid.cells[entry.cell].push_back(key);
+    }
+
+    // fetches the locations of all given entities of one type with one call into Lua, a vehicle without a location
+    // got destroyed by a Lua package
+    void Fetch(lua_State* L, EntityType type, const std::vector<int>& ids)
+    {
+        static constexpr const char* locationGetters[(int) EntityType::Count] = ENTITY_NAME_TABLE(GetLocation);
+        static constexpr const char* dimensionGetters[(int) EntityType::Count] = ENTITY_NAME_TABLE(GetDimension);
+
+        int top = lua_gettop(L);
+        int count = (int) ids.size();
+        lua_getglobal(L, "Onsharp_GetEntityLocations");
+        lua_pushstring(L, locationGetters[(int) type]);
+        lua_pushstring(L, dimensionGetters[(int) type]);
+        lua_createtable(L, count, 0);
+        for (int i = 0; i < count; i++)
+        {
+            lua_pushinteger(L, ids[i]);
+            lua_rawseti(L, -2, i + 1);
+        }
+
+        if (lua_pcall(L, 3, 1, 0) != LUA_OK || !lua_istable(L, -1))
+        {
+            lua_settop(L, top);
+            return;
+        }
+
+        // every entity has the values { found, x, y, z, dimension }
+        double values[5];
+        for (int i = 0; i < count; i++)
+        {
+            for (int v = 0; v < 5; v++)
+            {
+                lua_rawgeti(L, top + 1, i * 5 + v + 1);
+                values[v] = lua_tonumber(L, -1);
+                lua_pop(L, 1);
+            }
+
+            if (values[0] == 0)
+            {
+                if (type == EntityType::Vehicle && EntityRegistry::Get()->IsValid(type, ids[i]))
+                    Plugin::Get()->OnEntityDestroyed(type, ids[i]);
+                continue;
+            }
+
+            uint32_t dimension = (uint32_t) values[4];
+            DimensionIndex::Get()->TryGet(type, ids[i], dimension);
+            Update(type, ids[i], dimension, values[1], values[2], values[3]);
+        }
+        lua_settop(L, top);
+    }
+
+    template<typename Visitor>
+    void VisitCells(const Grid& grid, int32_t minX, int32_t minY, int32_t maxX, int32_t maxY, Visitor visit) const
+    {
+        minX = std::max(minX, grid.minX);
+        minY = std::max(minY, grid.minY);
+        maxX = std::min(maxX, grid.maxX);
+        maxY = std::min(maxY, grid.maxY);
+        for (int32_t cx = minX; cx <= maxX; cx++)
+        {
+            for (int32_t cy = minY; cy <= maxY; cy++)
+            {
+                auto cell = grid.cells.find(MakeCell(cx, cy));
+                if (cell == grid.cells.end())
+                    continue;
+                for (uint64_t key : cell->second)
+                    visit(this->entries.at(key));
+            }
+        }
+    }
+
+public:
+    static bool IsIndexed(EntityType type)
+    {
+        return type != EntityType::Count && (SPATIAL_TYPE_MASK & (1 << (int) type)) != 0;
+    }
+
+    void Update(EntityType type, int id, uint32_t dimension, double x, double y, double z)
+    {
+        if (!IsIndexed(type))
+            return;
+
+        uint64_t key = MakeKey(type, id);
+        int64_t cell = MakeCell(ToCell(x), ToCell(y));
+        auto it = this->entries.find(key);
+        if (it == this->entries.end())
+        {
+            Entry& entry = this->entries[key];
+            entry = { type, id, dimension, x, y, z, cell };
+            Link(entry, key);
+            return;
+        }
+
+        Entry& entry = it->second;
+        if (entry.cell != cell || entry.dimension != dimension)
+        {
+            Unlink(entry, key);
+            entry.cell = cell;
+            entry.dimension = dimension;
+            Link(entry, key);
+        }
+        entry.x = x;
+        entry.y = y;
+        entry.z = z;
+    }
+
+    void UpdatePosition(EntityType type, int id, double x, double y, double z)
+    {
+        auto it = this->entries.find(MakeKey(type, id));
+        if (it != this->entries.end())
+            Update(type, id, it->second.dimension, x, y, z);
+        else
+            MarkDirty(type, id);
+    }
+
+    void UpdateDimension(EntityType type, int id, uint32_t dimension)
+    {
+        auto it = this->entries.find(MakeKey(type, id));
+        if (it != this->entries.end())
+            Update(type, id, dimension, it->second.x, it->second.y, it->second.z);
+        else
+            MarkDirty(type, id);
+    }
+
+    void MarkDirty(EntityType type, int id)
+    {
+        if (IsIndexed(type))
+            this->dirty.push_back(MakeKey(type, id));
+    }
+
+    // the entity is refreshed every tick until it stops moving
+    void MarkMoving(EntityType type, int id)
+    {
+        if (IsIndexed(type))
+            this->moving.insert(MakeKey(type, id));
+    }
+
+    void StopMoving(EntityType type, int id)
+    {
+        if (this->moving.erase(MakeKey(type, id)) > 0)
+            MarkDirty(type, id);
+    }
+
+    void Remove(EntityType type, int id)
+    {
+        uint64_t key = MakeKey(type, id);
+        this->moving.erase(key);
+        auto it = this->entries.find(key);
+        if (it == this->entries.end())
+            return;
+
+        Unlink(it->second, key);
+        this->entries.erase(it);
+    }
+
+    // refreshes the dirty and moving entities and a round robin slice of the players, vehicles and NPCs
+    void Refresh(lua_State* L)
+    {
+        if (L == nullptr)
+            return;
+
+        for (std::vector<int>& ids : this->fetches)
+            ids.clear();
+
+        for (uint64_t key : this->dirty)
+        {
+            auto type = (EntityType) (key >> 32);
+            int id = (int) (uint32_t) key;
+            if (EntityRegistry::Get()->IsValid(type, id))
+                this->fetches[(int) type].push_back(id);
+        }
+        this->dirty.clear();
+
+        for (uint64_t key : this->moving)
+            this->fetches[key >> 32].push_back((int) (uint32_t) key);
+
+        for (int type = 0; type < (int) EntityType::Count; type++)
+        {
+            const std::vector<int>& ids = EntityRegistry::Get()->GetIds((EntityType) type);
+            size_t count = std::min((size_t) RefreshBudgets[type], ids.size());
+            size_t& cursor = this->cursors[type];
+            for (size_t i = 0; i < count; i++)
+            {
+                if (cursor >= ids.size())
+                    cursor = 0;
+                this->fetches[type].push_back(ids[cursor++]);
+            }
+        }
+
+        for (int type = 0; type < (int) EntityType::Count; type++)
+        {
+            if (!this->fetches[type].empty())
+                Fetch(L, (EntityType) type, this->fetches[type]);
+        }
+    }
+
+    int QueryRadius(uint32_t dimension, double x, double y, double z, double radius, int typeMask, std::vector<Hit>& hits) const
+    {
+        auto grid = this->grids.find(dimension);
+        if (grid == this->grids.end())
+            return 0;
+
+        double radiusSq = radius * radius;
+        VisitCells(grid->second, ToCell(x - radius), ToCell(y - radius), ToCell(x + radius), ToCell(y + radius),
+                   [&](const Entry& entry) {
+                       if ((typeMask & (1 << (int) entry.type)) == 0)
+                           return;
+                       double dx = entry.x - x, dy = entry.y - y, dz = entry.z - z;
+                       double distSq = dx * dx + dy * dy + dz * dz;
+                       if (distSq <= radiusSq)
+                           hits.push_back({ entry.type, entry.id, std::sqrt(distSq) });
+                   });
+        return (int) hits.size();
+    }
+
+    int QueryBox(uint32_t dimension, double minX, double minY, double minZ, double maxX, double maxY, double maxZ,
+                 int typeMask, std::vector<Hit>& hits) const
+    {
+        auto grid = this->grids.find(dimension);
+        if (grid == this->grids.end())
+            return 0;
+
+        VisitCells(grid->second, ToCell(minX), ToCell(minY), ToCell(maxX), ToCell(maxY),
+                   [&](const Entry& entry) {
+                       if ((typeMask & (1 << (int) entry.type)) == 0)
+                           return;
+                       if (entry.x >= minX && entry.x <= maxX && entry.y >= minY && entry.y <= maxY
+                           && entry.z >= minZ && entry.z <= maxZ)
+                           hits.push_back({ entry.type, entry.id, 0 });
+                   });
+        return (int) hits.size();
+    }
+
+    // searches the cell rings around the position until no unvisited cell can contain a closer entity
+    int QueryNearest(uint32_t dimension, double x, double y, double z, int typeMask, int k, std::vector<Hit>& hits) const
+    {
+        auto found = this->grids.find(dimension);
+        if (found == this->grids.end() || k <= 0)
+            return 0;
+
+        const Grid& grid = found->second;
+        int32_t cx = ToCell(x), cy = ToCell(y);
+        int32_t maxRing = std::max(std::max(cx - grid.minX, grid.maxX - cx), std::max(cy - grid.minY, grid.maxY - cy));
+        auto byDistance = [](const Hit& a, const Hit& b) { return a.distance < b.distance; };
+        auto visit = [&](const Entry& entry) {
+            if ((typeMask & (1 << (int) entry.type)) == 0)
+                return;
+            double dx = entry.x - x, dy = entry.y - y, dz = entry.z - z;
+            hits.push_back({ entry.type, entry.id, std::sqrt(dx * dx + dy * dy + dz * dz) });
+        };
+
+        for (int32_t ring = 0; ring <= maxRing; ring++)
+        {
+            if (ring == 0)
+            {
+                VisitCells(grid, cx, cy, cx, cy, visit);
+            }
+            else
+            {
+                VisitCells(grid, cx - ring, cy - ring, cx + ring, cy - ring, visit);
+                VisitCells(grid, cx - ring, cy + ring, cx + ring, cy + ring, visit);
+                VisitCells(grid, cx - ring, cy - ring + 1, cx - ring, cy + ring - 1, visit);
+                VisitCells(grid, cx + ring, cy - ring + 1, cx + ring, cy + ring - 1, visit);
+            }
+
+            if ((int) hits.size() >= k)
+            {
+                std::nth_element(hits.begin(), hits.begin() + (k - 1), hits.end(), byDistance);
+                if (hits[k - 1].distance <= ring * SPATIAL_CELL_SIZE)
+                    break;
+            }
+        }
+
+        std::sort(hits.begin(), hits.end(), byDistance);
+        if ((int) hits.size() > k)
+            hits.resize(k);
+        return (int) hits.size();
+    }
+};
+
+#endif
@@ -0,0 +1,211 @@
+#pragma once
+#ifndef __TICK_MONITOR_H__
+#define __TICK_MONITOR_H__
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "Singleton.hpp"
+#include "LogRing.hpp"
+
+#define TICK_MONITOR_SPANS 64
+#define TICK_MONITOR_NAME_LENGTH 32
+#define TICK_HISTOGRAM_BUCKETS 11
+#define TICK_HISTOGRAM_WINDOW 1024
+#define TICK_DUMP_COOLDOWN 1000
+
+enum class TraceCategory : uint8_t
+{
+    Tick = 0,
+    Bridge = 1,
+    Lua = 2,
+    Managed = 3
+};
+
+inline const char* GetTraceCategoryName(TraceCategory category)
+{
+    switch (category)
+    {
+        case TraceCategory::Tick: return "tick";
+        case TraceCategory::Bridge: return "bridge";
+        case TraceCategory::Lua: return "lua";
+        default: return "managed";
+    }
+}
+
+// Measures every outermost span on the main thread, which is a server tick or a bridge call like an event dispatch.
+// The nested spans of the running frame are kept in a fixed list, frames above the threshold get dumped into the log.
+// The durations of the last ticks are kept in a rolling histogram with power of two millisecond buckets.
+class TickMonitor : public Singleton<TickMonitor>
+{
+    friend class Singleton<TickMonitor>;
+private:
+    struct Span
+    {
+        int64_t start;
+        int64_t duration;
+        int32_t value;
+        TraceCategory category;
+        uint8_t depth;
+        char name[TICK_MONITOR_NAME_LENGTH];
+    };
+
+    static bool& IsMainThread()
+    {
+        thread_local bool mainThread = false;
+        return mainThread;
+    }
+
+    Span spans[TICK_MONITOR_SPANS];
+    int spanCount = 0;
+    int omitted = 0;
+    int depth = 0;
+    int64_t threshold = 50 * 1000000LL;
+    int64_t lastDump = 0;
+    int suppressed = 0;
+
+    uint8_t window[TICK_HISTOGRAM_WINDOW] = {};
+    int windowPos = 0;
+    int windowSize = 0;
+    int buckets[TICK_HISTOGRAM_BUCKETS] = {};
+
+    TickMonitor() = default;
+    ~TickMonitor() = default;
+
+    static int64_t Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static int GetBucket(int64_t duration)
+    {
+        int bucket = 0;
+        int64_t bound = 1000000;
+        while (bucket < TICK_HISTOGRAM_BUCKETS - 1 && duration > bound)
+        {
+            bound <<= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+
+    void AddTick(int64_t duration)
+    {
+        int bucket = GetBucket(duration);
+        if (this->windowSize == TICK_HISTOGRAM_WINDOW)
+            this->buckets[this->window[this->windowPos]]--;
+        else
+            this->windowSize++;
+        this->window[this->windowPos] = (uint8_t) bucket;
+        this->buckets[bucket]++;
+        this->windowPos = (this->windowPos + 1) % TICK_HISTOGRAM_WINDOW;
+    }
+
+    void Dump(const Span& root, int64_t now)
+    {
+        // dumps are rate limited, a server which keeps being slow would otherwise flood the log
+        if (now - this->lastDump < TICK_DUMP_COOLDOWN * 1000000LL)
+        {
+            this->suppressed++;
+            return;
+        }
+
+        LogRing* log = LogRing::Get();
+        log->Writef(LogLevel::Warning, "Onsharp: slow %s %s took %.2f ms (threshold %.2f ms, %d slow frames suppressed)",
+                GetTraceCategoryName(root.category), root.name, root.duration / 1e6, this->threshold / 1e6, this->suppressed);
+        for (int i = 1; i < this->spanCount; i++)
+        {
+            const Span& span = this->spans[i];
+            char value[16] = "";
+            if (span.value >= 0)
+                snprintf(value, sizeof(value), " %d", span.value);
+            log->Writef(LogLevel::Warning, "Onsharp: %*s+%.2f ms %s %s%s took %.2f ms", span.depth * 2, "",
+                    (span.start - root.start) / 1e6, GetTraceCategoryName(span.category), span.name, value,
+                    span.duration / 1e6);
+        }
+        if (this->omitted > 0)
+            log->Writef(LogLevel::Warning, "Onsharp: %d further spans were not recorded", this->omitted);
+
+        this->lastDump = now;
+        this->suppressed = 0;
+    }
+
+public:
+    // marks the calling thread as the one running the ticks, spans of other threads are ignored
+    void MarkMainThread()
+    {
+        IsMainThread() = true;
+    }
+
+    // sets the threshold in milliseconds above which frames get dumped, zero disables the dumps
+    void Configure(double thresholdMs)
+    {
+        this->threshold = thresholdMs > 0 ? (int64_t) (thresholdMs * 1e6) : 0;
+    }
+
+    // returns the span index to leave with, or a negative value if the span is not monitored
+    int Enter(TraceCategory category, const char* name, int value)
+    {
+        if (!IsMainThread())
+            return -1;
+
+        if (this->depth == 0)
+        {
+            this->spanCount = 0;
+            this->omitted = 0;
+        }
+
+        int index = -2;
+        if (this->spanCount < TICK_MONITOR_SPANS)
+        {
+            index = this->spanCount++;
+            Span& span = this->spans[index];
+            span.duration = 0;
+            span.value = value;
+            span.category = category;
+            span.depth = (uint8_t) this->depth;
+            strncpy(span.name, name, TICK_MONITOR_NAME_LENGTH - 1);
+            span.name[TICK_MONITOR_NAME_LENGTH - 1] = '\0';
+            span.start = Now();
+        }
+        else
+        {
+            this->omitted++;
+        }
+        this->depth++;
+        return index;
+    }
+
+    void Leave(int index)
+    {
+        if (index == -1)
+            return;
+
+        int64_t now = Now();
+        this->depth--;
+        if (index >= 0)
+            this->spans[index].duration = now - this->spans[index].start;
+
+        if (this->depth != 0)
+            return;
+
+        const Span& root = this->spans[0];
+        if (root.category == TraceCategory::Tick)
+            AddTick(root.duration);
+
+        if (this->threshold > 0 && root.duration > this->threshold)
+            Dump(root, now);
+    }
+
+    // writes the tick counts of the buckets, bucket i counts the ticks up to 2^i ms, the last one all slower ticks
+    int GetHistogram(int* counts, int capacity)
+    {
+        int count = capacity < TICK_HISTOGRAM_BUCKETS ? capacity : TICK_HISTOGRAM_BUCKETS;
+        for (int i = 0; i < count; i++)
+            counts[i] = this->buckets[i];
+        return count;
+    }
+};
+
+#endif
@@ -0,0 +1,255 @@
+#pragma once
+#ifndef __TRACE_RECORDER_H__
+#define __TRACE_RECORDER_H__
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include "Singleton.hpp"
+#include "LogRing.hpp"
+#include "TickMonitor.hpp"
+
+#define TRACE_CAPACITY 16384
+#define TRACE_NAME_LENGTH 40
+#define TRACE_MAX_SECONDS 60
+#define TRACE_END_GRACE 1
+
+// Records begin and end spans into a fixed buffer for a limited time and writes them as chrome trace events
+// (chrome://tracing, perfetto) into the onsharp logs folder. While no trace is running, every hook is one relaxed load.
+// Every recorded begin reserves the slot of its end, so the spans in a full buffer are still closed. The file is
+// written on a background thread once the open spans ended.
+class TraceRecorder : public Singleton<TraceRecorder>
+{
+    friend class Singleton<TraceRecorder>;
+private:
+    struct Event
+    {
+        int64_t time;
+        int32_t value;
+        uint16_t thread;
+        char phase;
+        TraceCategory category;
+        char name[TRACE_NAME_LENGTH];
+    };
+
+    Event* events;
+    std::atomic<bool> active{false};
+    std::atomic<bool> accepting{false};
+    std::atomic<size_t> count{0};
+    std::atomic<size_t> reserved{0};
+    std::atomic<int> open{0};
+    std::atomic<int> writers{0};
+    std::atomic<bool> writing{false};
+    std::thread writer;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point deadline;
+    std::chrono::steady_clock::time_point stopped;
+    bool stopping = false;
+    std::atomic<uint16_t> nextThread{0};
+
+    TraceRecorder()
+    {
+        this->events = new Event[TRACE_CAPACITY];
+    }
+
+    ~TraceRecorder()
+    {
+        if (this->writer.joinable())
+            this->writer.join();
+        delete[] this->events;
+    }
+
+    uint16_t GetThread()
+    {
+        thread_local uint16_t thread = this->nextThread.fetch_add(1) + 1;
+        return thread;
+    }
+
+    static void WriteEscaped(FILE* file, const char* text)
+    {
+        for (; *text != '\0'; text++)
+        {
+            unsigned char c = (unsigned char) *text;
+            if (c == '"' || c == '\\')
+                fprintf(file, "\\%c", c);
+            else if (c < 0x20)
+                fprintf(file, "\\u%04x", c);
+            else
+                fputc(c, file);
+        }
+    }
+
+    // runs on the writer thread and owns the given events
+    void Write(Event* written, size_t total)
+    {
+        char stamp[32];
+        time_t now = std::time(nullptr);
+        strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", std::localtime(&now));
+        std::filesystem::path directory = std::filesystem::current_path() / "onsharp" / "logs" / "traces";
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        std::string path = (directory / ("trace_" + std::string(stamp) + ".json")).string();
+        FILE* file = fopen(path.c_str(), "w");
+        if (file == nullptr)
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: could not write the trace to %s", path.c_str());
+            delete[] written;
+            this->writing.store(false, std::memory_order_release);
+            return;
+        }
+
+        fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+        for (size_t i = 0; i < total; i++)
+        {
+            const Event& e = written[i];
+            fprintf(file, "%s\n{\"name\":\"", i == 0 ? "" : ",");
+            WriteEscaped(file, e.name);
+            fprintf(file, "\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u",
+                    GetTraceCategoryName(e.category), e.phase, e.time / 1000.0, (unsigned) e.thread);
+            if (e.phase == 'B' && e.value >= 0)
+                fprintf(file, ",\"args\":{\"value\":%d}", e.value);
+            fputc('}', file);
+        }
+        fputs("\n]}\n", file);
+        fclose(file);
+        delete[] written;
+        LogRing::Get()->Writef(LogLevel::Info, "Onsharp: trace with %zu events written to %s", total, path.c_str());
+        this->writing.store(false, std::memory_order_release);
+    }
+
+public:
+    bool IsActive() const
+    {
+        return this->active.load(std::memory_order_relaxed);
+    }
+
+    // starts a trace for the given seconds, returns false if a trace is already running or still being written
+    bool Start(int seconds)
+    {
+        if (IsActive() || this->count.load() != 0 || this->writing.load())
+            return false;
+
+        if (seconds < 1)
+            seconds = 1;
+        else if (seconds > TRACE_MAX_SECONDS)
+            seconds = TRACE_MAX_SECONDS;
+
+        this->reserved.store(0);
+        this->open.store(0);
+        this->start = std::chrono::steady_clock::now();
+        this->deadline = this->start + std::chrono::seconds(seconds);
+        this->accepting.store(true);
+        this->active.store(true, std::memory_order_release);
+        return true;
+    }
+
+    // returns false if the event was not recorded, the matching end must then be skipped as well
+    bool Record(char phase, TraceCategory category, const char* name, int value = -1)
+    {
+        if (!IsActive() && (phase != 'E' || !this->accepting.load(std::memory_order_relaxed)))
+            return false;
+
+        // the writer count keeps Poll from taking the buffer while an event is written into it
+        this->writers.fetch_add(1);
+        bool recorded = false;
+        if (phase == 'B' ? IsActive() : this->accepting.load())
+        {
+            // a begin takes its own slot and the one of its end, it is refused when only the reserve is left
+            if (phase != 'B' || this->reserved.fetch_add(2) + 2 <= TRACE_CAPACITY)
+            {
+                size_t index = this->count.fetch_add(1, std::memory_order_relaxed);
+                if (index < TRACE_CAPACITY)
+                {
+                    Event& e = this->events[index];
+                    e.time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->start).count();
+                    e.value = value;
+                    e.thread = GetThread();
+                    e.phase = phase;
+                    e.category = category;
+                    strncpy(e.name, name, TRACE_NAME_LENGTH - 1);
+                    e.name[TRACE_NAME_LENGTH - 1] = '\0';
+                    recorded = true;
+                    this->open.fetch_add(phase == 'B' ? 1 : -1);
+                }
+            }
+            else
+            {
+                this->active.store(false);
+            }
+        }
+        this->writers.fetch_sub(1);
+        return recorded;
+    }
+
+    // Called once per server tick. As soon as the duration elapsed or the buffer ran full, it waits for the open spans
+    // to end, at most TRACE_END_GRACE seconds, and hands the events to the writer thread.
+    void Poll()
+    {
+        if (this->count.load(std::memory_order_relaxed) == 0 || this->writing.load(std::memory_order_acquire))
+            return;
+
+        auto now = std::chrono::steady_clock::now();
+        if (IsActive() && now < this->deadline)
+            return;
+
+        this->active.store(false);
+        if (!this->stopping)
+        {
+            this->stopping = true;
+            this->stopped = now;
+        }
+
+        if (this->open.load() > 0 && now < this->stopped + std::chrono::seconds(TRACE_END_GRACE))
+            return;
+
+        this->stopping = false;
+
+        this->accepting.store(false);
+        while (this->writers.load() > 0)
+            std::this_thread::yield();
+
+        size_t total = this->count.load();
+        if (total > TRACE_CAPACITY)
+            total = TRACE_CAPACITY;
+
+        Event* written = this->events;
+        this->events = new Event[TRACE_CAPACITY];
+        if (this->writer.joinable())
+            this->writer.join();
+        this->writing.store(true);
+        this->writer = std::thread(&TraceRecorder::Write, this, written, total);
+        this->count.store(0);
+    }
+};
+
+// Records a begin span on construction and its end on destruction if the begin has been recorded. The span is
+// measured by the tick monitor as well.
+class TraceScope
+{
+private:
+    const char* name;
+    TraceCategory category;
+    bool recorded;
+    int span;
+
+public:
+    TraceScope(TraceCategory category, const char* name, int value = -1) : name(name), category(category)
+    {
+        this->recorded = TraceRecorder::Get()->Record('B', category, name, value);
+        this->span = TickMonitor::Get()->Enter(category, name, value);
+    }
+
+    ~TraceScope()
+    {
+        TickMonitor::Get()->Leave(this->span);
+        if (this->recorded)
+            TraceRecorder::Get()->Record('E', this->category, this->name);
+    }
+};
+
+#endif
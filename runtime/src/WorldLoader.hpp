@@ -0,0 +1,329 @@
+#pragma once
+#ifndef __WORLD_LOADER_H__
+#define __WORLD_LOADER_H__
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <cstdint>
+#include <cstring>
+#include "Singleton.hpp"
+#include "EntityType.hpp"
+#include "MappedFile.hpp"
+#include "LogRing.hpp"
+#include "Plugin.hpp"
+
+#define WORLD_LAYOUT_MAGIC "OWLF"
+#define WORLD_LAYOUT_VERSION 1
+#define WORLD_LAYOUT_INTERACT 1
+
+// A world layout file is the header, followed by the fixed size entries and the text block holding the UTF-8 texts
+// of the 3D texts. All values are little endian.
+struct WorldLayoutHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t count;
+    uint32_t textSize;
+};
+
+struct WorldLayoutEntry
+{
+    uint8_t type;
+    uint8_t flags;
+    uint16_t textLength;
+    int32_t model; // the text size for 3D texts
+    float x, y, z;
+    float rx, ry, rz; // doors use ry as their yaw
+    float sx, sy, sz;
+    uint32_t textOffset;
+};
+
+static_assert(sizeof(WorldLayoutHeader) == 16, "the world layout header has to stay 16 bytes");
+static_assert(sizeof(WorldLayoutEntry) == 48, "the world layout entry has to stay 48 bytes");
+
+// spawns the objects, pickups, 3D texts and doors of world layout files and the entities of restored world snapshots in
+// chunks spread over several ticks. The created events of a layout are not forwarded to the plugins while a chunk
+// spawns, the ids are handed over once the layout is done
+class WorldLoader : public Singleton<WorldLoader>
+{
+    friend class Singleton<WorldLoader>;
+private:
+    struct Job
+    {
+        int id = 0;
+        MappedFile file;
+        const WorldLayoutEntry* entries = nullptr;
+        const char* texts = nullptr;
+        uint32_t count = 0;
+        uint32_t next = 0;
+        uint32_t dimension = 0;
+        int perTick = 0;
+        std::vector<int> ids;
+        std::vector<int> types;
+        std::vector<WorldLayoutEntry> ownedEntries;
+        std::string ownedTexts;
+        std::function<void(uint32_t, int)> onSpawned;
+        bool forwardEvents = false;
+        bool notify = true;
+        bool done = false;
+    };
+
+    std::vector<std::unique_ptr<Job>> jobs;
+    int nextId = 1;
+
+    WorldLoader() = default;
+    ~WorldLoader() = default;
+
+    Job* Find(int id) const
+    {
+        for (const auto& job : this->jobs)
+        {
+            if (job->id == id)
+                return job.get();
+        }
+        return nullptr;
+    }
+
+    static bool Validate(Job& job, const std::string& path)
+    {
+        const uint8_t* data = job.file.GetData();
+        size_t size = job.file.GetSize();
+        if (size < sizeof(WorldLayoutHeader))
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: world layout %s is too small", path.c_str());
+            return false;
+        }
+
+        WorldLayoutHeader header;
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.magic, WORLD_LAYOUT_MAGIC, 4) != 0 || header.version != WORLD_LAYOUT_VERSION)
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: %s is no world layout of version %d", path.c_str(),
+                    WORLD_LAYOUT_VERSION);
+            return false;
+        }
+
+        uint64_t expected = sizeof(WorldLayoutHeader) + (uint64_t) header.count * sizeof(WorldLayoutEntry) + header.textSize;
+        if (expected > size)
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: world layout %s is truncated", path.c_str());
+            return false;
+        }
+
+        job.entries = (const WorldLayoutEntry*) (data + sizeof(WorldLayoutHeader));
+        job.texts = (const char*) (data + sizeof(WorldLayoutHeader) + header.count * sizeof(WorldLayoutEntry));
+        job.count = header.count;
+        for (uint32_t i = 0; i < job.count; i++)
+        {
+            const WorldLayoutEntry& entry = job.entries[i];
+            if ((uint64_t) entry.textOffset + entry.textLength > header.textSize)
+            {
+                LogRing::Get()->Writef(LogLevel::Error, "Onsharp: entry %u of world layout %s points outside of the texts",
+                        i, path.c_str());
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static int Spawn(lua_State* L, const Job& job, const WorldLayoutEntry& entry)
+    {
+        Plugin* plugin = Plugin::Get();
+        bool ok = false;
+        switch ((EntityType) entry.type)
+        {
+            case EntityType::Vehicle:
+                ok = plugin->CallLuaDirect("CreateVehicle", 1, (int) entry.model, (double) entry.x, (double) entry.y,
+                        (double) entry.z, (double) entry.ry);
+                break;
+            case EntityType::NPC:
+                ok = plugin->CallLuaDirect("CreateNPC", 1, (double) entry.x, (double) entry.y, (double) entry.z,
+                        (double) entry.ry);
+                break;
+            case EntityType::Object:
+                ok = plugin->CallLuaDirect("CreateObject", 1, (int) entry.model, (double) entry.x, (double) entry.y,
+                        (double) entry.z, (double) entry.rx, (double) entry.ry, (double) entry.rz, (double) entry.sx,
+                        (double) entry.sy, (double) entry.sz);
+                break;
+            case EntityType::Pickup:
+                ok = plugin->CallLuaDirect("CreatePickup", 1, (int) entry.model, (double) entry.x, (double) entry.y,
+                        (double) entry.z);
+                break;
+            case EntityType::Text3D:
+                ok = plugin->CallLuaDirect("CreateText3D", 1, Plugin::LuaString{ job.texts + entry.textOffset, entry.textLength },
+                        (int) entry.model, (double) entry.x, (double) entry.y, (double) entry.z, (double) entry.rx,
+                        (double) entry.ry, (double) entry.rz);
+                break;
+            case EntityType::Door:
+                ok = plugin->CallLuaDirect("CreateDoor", 1, (int) entry.model, (double) entry.x, (double) entry.y,
+                        (double) entry.z, (double) entry.ry, (entry.flags & WORLD_LAYOUT_INTERACT) != 0);
+                break;
+            default:
+                return 0;
+        }
+        if (!ok)
+            return 0;
+
+        int id = (int) lua_tointeger(L, -1);
+        lua_pop(L, 1);
+        return id;
+    }
+
+    static void SetCreatedEventsForwarded(bool forwarded)
+    {
+        Plugin::Get()->CallLuaDirect("Onsharp_SetCreatedEventsForwarded", 0, forwarded);
+    }
+
+    void Complete(Job& job)
+    {
+        job.done = true;
+        job.entries = nullptr;
+        job.texts = nullptr;
+        job.file.Close();
+
+        Plugin::NValue id;
+        id.type = Plugin::NTYPE::INTEGER;
+        id.iVal = job.id;
+        void* args[] = { &id };
+        delete Plugin::Get()->CallBridge("call-layout", args, 1);
+    }
+
+public:
+    // maps the layout file and queues it, 0 if the file is no valid layout
+    int Load(const std::string& path, uint32_t dimension, int perTick)
+    {
+        auto job = std::make_unique<Job>();
+        if (!job->file.Open(path))
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: could not map world layout %s", path.c_str());
+            return 0;
+        }
+        if (!Validate(*job, path))
+            return 0;
+
+        job->id = this->nextId++;
+        job->dimension = dimension;
+        job->perTick = perTick > 0 ? perTick : 500;
+        job->ids.resize(job->count, 0);
+        job->types.resize(job->count, -1);
+        this->jobs.push_back(std::move(job));
+        return this->jobs.back()->id;
+    }
+
+    // queues entries built in memory. Their created events are forwarded like the ones of any other entity, the
+    // callback runs after every spawned entity and the job releases itself once it is done
+    int Queue(std::vector<WorldLayoutEntry> entries, std::string texts, int perTick,
+              std::function<void(uint32_t, int)> onSpawned)
+    {
+        auto job = std::make_unique<Job>();
+        job->id = this->nextId++;
+        job->ownedEntries = std::move(entries);
+        job->ownedTexts = std::move(texts);
+        job->entries = job->ownedEntries.data();
+        job->texts = job->ownedTexts.data();
+        job->count = (uint32_t) job->ownedEntries.size();
+        job->perTick = perTick > 0 ? perTick : 500;
+        job->ids.resize(job->count, 0);
+        job->types.resize(job->count, -1);
+        job->onSpawned = std::move(onSpawned);
+        job->forwardEvents = true;
+        job->notify = false;
+        this->jobs.push_back(std::move(job));
+        return this->jobs.back()->id;
+    }
+
+    bool IsPending(int id) const
+    {
+        Job* job = Find(id);
+        return job != nullptr && !job->done;
+    }
+
+    // spawns the next chunk of the oldest unfinished layout
+    void Tick()
+    {
+        Job* job = nullptr;
+        for (const auto& candidate : this->jobs)
+        {
+            if (!candidate->done)
+            {
+                job = candidate.get();
+                break;
+            }
+        }
+        lua_State* L = Plugin::Get()->GetMainState();
+        if (job == nullptr || L == nullptr)
+            return;
+
+        static constexpr const char* dimensionSetters[(int) EntityType::Count] = ENTITY_NAME_TABLE(SetDimension);
+        uint32_t end = job->count - job->next > (uint32_t) job->perTick ? job->next + (uint32_t) job->perTick : job->count;
+        if (!job->forwardEvents)
+            SetCreatedEventsForwarded(false);
+        for (; job->next < end; job->next++)
+        {
+            const WorldLayoutEntry& entry = job->entries[job->next];
+            int id = Spawn(L, *job, entry);
+            if (id <= 0)
+                continue;
+
+            auto type = (EntityType) entry.type;
+            job->ids[job->next] = id;
+            job->types[job->next] = (int) entry.type;
+            Plugin::Get()->OnEntityCreated(type, id);
+            if (job->dimension != 0)
+            {
+                Plugin::Get()->CallLuaDirect(dimensionSetters[entry.type], 0, id, job->dimension);
+                Plugin::Get()->SetEntityDimension(type, id, job->dimension);
+            }
+            if (job->onSpawned)
+                job->onSpawned(job->next, id);
+        }
+        if (!job->forwardEvents)
+            SetCreatedEventsForwarded(true);
+
+        if (job->next >= job->count)
+        {
+            if (job->notify)
+                Complete(*job);
+            else
+                Release(job->id);
+        }
+    }
+
+    // drops every layout, the unfinished ones are not spawned any further
+    void Clear()
+    {
+        this->jobs.clear();
+    }
+
+    // copies the ids and types of the spawned entities in layout order, a failed entry has the id 0. Returns the
+    // amount of entries or -1 for an unknown or unfinished layout
+    int GetIds(int id, int* ids, int* types, int size) const
+    {
+        Job* job = Find(id);
+        if (job == nullptr || !job->done)
+            return -1;
+
+        int count = (int) job->count < size ? (int) job->count : size;
+        if (count <= 0)
+            return (int) job->count;
+
+        memcpy(ids, job->ids.data(), sizeof(int) * (size_t) count);
+        memcpy(types, job->types.data(), sizeof(int) * (size_t) count);
+        return (int) job->count;
+    }
+
+    void Release(int id)
+    {
+        for (auto it = this->jobs.begin(); it != this->jobs.end(); ++it)
+        {
+            if ((*it)->id == id)
+            {
+                this->jobs.erase(it);
+                return;
+            }
+        }
+    }
+};
+
+#endif
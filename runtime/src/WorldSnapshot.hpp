@@ -0,0 +1,808 @@
+#pragma once
+#ifndef __WORLD_SNAPSHOT_H__
+#define __WORLD_SNAPSHOT_H__
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+#include <PluginSDK.h>
+#include "Singleton.hpp"
+#include "EntityType.hpp"
+#include "EntityStatus.hpp"
+#include "EntityRegistry.hpp"
+#include "DimensionIndex.hpp"
+#include "PropertyStore.hpp"
+#include "EntityFunctions.hpp"
+#include "WorldLoader.hpp"
+#include "MappedFile.hpp"
+#include "KvStore.hpp"
+#include "LogRing.hpp"
+#include "Plugin.hpp"
+
+#define WORLD_SNAPSHOT_MAGIC "OWSS"
+#define WORLD_SNAPSHOT_VERSION 1
+#define WORLD_SNAPSHOT_HEADER 8
+#define WORLD_SNAPSHOT_FULL 0
+#define WORLD_SNAPSHOT_DELTA 1
+#define WORLD_SNAPSHOT_DAMAGES 8
+#define WORLD_SNAPSHOT_PER_TICK 256
+
+// valid, model, x, y, z, rx, ry, rz, health, color, damage 1 to 8
+#define VEHICLE_SNAPSHOT_FIELDS 18
+// valid, model, x, y, z, rx, ry, rz, sx, sy, sz
+#define OBJECT_SNAPSHOT_FIELDS 11
+
+// Periodically writes the state of the persistent vehicles, objects and NPCs together with their properties to the data
+// folder, so a crashed server can bring them back at the next boot. Entities are only persistent when a plugin marks
+// them, the ones a plugin creates again on its own at the boot stay out. The first snapshot after the start is a full
+// frame written to a new file which replaces the old one, every later snapshot appends a delta frame with the records
+// which changed since the previous one. The game thread reads the state in slices of WORLD_SNAPSHOT_PER_TICK entities
+// with one Lua call per entity type and tick, the diff and the disk writes run on the writer thread. A graceful stop
+// moves the snapshot aside, so only a crash leaves one behind.
+class WorldSnapshot : public Singleton<WorldSnapshot>
+{
+    friend class Singleton<WorldSnapshot>;
+private:
+    // the encoded state of every entity, keyed like the other indices
+    using Frame_t = std::unordered_map<uint64_t, std::string>;
+
+    // a frame is the header and the records. The crc covers everything after it, a broken frame ends the snapshot
+    struct FrameHeader
+    {
+        uint32_t crc;
+        uint32_t size;
+        uint32_t kind;
+        uint32_t count;
+    };
+
+    struct RecordHeader
+    {
+        uint8_t removed;
+        uint8_t type;
+        uint16_t reserved;
+        int32_t id;
+        uint32_t length;
+    };
+
+    struct State
+    {
+        EntityType type = EntityType::Count;
+        uint32_t dimension = 0;
+        int32_t model = 0;
+        double x = 0, y = 0, z = 0;
+        double rx = 0, ry = 0, rz = 0; // NPCs keep their heading in ry
+        double sx = 1, sy = 1, sz = 1;
+        double health = 0;
+        uint32_t color = 0;
+        float damage[WORLD_SNAPSHOT_DAMAGES] = {};
+        std::string plate;
+        std::vector<std::pair<std::string, Plugin::NValue>> properties;
+    };
+
+    // reads the values of an encoded record and fails instead of reading past its end
+    struct Reader
+    {
+        const uint8_t* data;
+        size_t size;
+        size_t offset = 0;
+
+        template<typename V>
+        bool Read(V& value)
+        {
+            if (this->size - this->offset < sizeof(V))
+                return false;
+            memcpy(&value, this->data + this->offset, sizeof(V));
+            this->offset += sizeof(V);
+            return true;
+        }
+
+        bool ReadString(std::string& value, size_t length)
+        {
+            if (this->size - this->offset < length)
+                return false;
+            value.assign((const char*) this->data + this->offset, length);
+            this->offset += length;
+            return true;
+        }
+    };
+
+    std::string path;
+    float interval = 0;
+    float elapsed = 0;
+    int restoreJob = 0;
+    bool owned = false;
+    std::vector<double> values;
+    std::vector<std::string> strings;
+    std::unordered_set<uint64_t> persistent;
+
+    // the snapshot which is captured over the next ticks
+    std::unique_ptr<Frame_t> capturing;
+    std::vector<int> captureIds[(int) EntityType::Count];
+    size_t captureCursors[(int) EntityType::Count] = {};
+
+    // shared with the writer thread
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::unique_ptr<Frame_t> queued;
+    bool running = false;
+    std::thread writer;
+
+    // only touched by the writer thread
+    Frame_t written;
+    FILE* file = nullptr;
+    uint64_t baseBytes = 0;
+    uint64_t deltaBytes = 0;
+
+    WorldSnapshot()
+    {
+        this->path = (std::filesystem::current_path() / "onsharp" / "data" / "_world" / "world.snap").string();
+    }
+
+    ~WorldSnapshot()
+    {
+        Stop();
+    }
+
+    static uint64_t MakeKey(EntityType type, int id)
+    {
+        return ((uint64_t) type << 32) | (uint32_t) id;
+    }
+
+    template<typename V>
+    static void Append(std::string& out, V value)
+    {
+        out.append((const char*) &value, sizeof(V));
+    }
+
+    static void Encode(const State& state, std::string& out)
+    {
+        Append(out, state.dimension);
+        Append(out, state.model);
+        Append(out, state.x);
+        Append(out, state.y);
+        Append(out, state.z);
+        Append(out, state.rx);
+        Append(out, state.ry);
+        Append(out, state.rz);
+        if (state.type == EntityType::Object)
+        {
+            Append(out, state.sx);
+            Append(out, state.sy);
+            Append(out, state.sz);
+        }
+        else if (state.type == EntityType::Vehicle)
+        {
+            Append(out, state.health);
+            Append(out, state.color);
+            out.append((const char*) state.damage, sizeof(state.damage));
+            Append(out, (uint16_t) state.plate.size());
+            out.append(state.plate);
+        }
+        else if (state.type == EntityType::NPC)
+        {
+            Append(out, state.health);
+        }
+
+        Append(out, (uint16_t) state.properties.size());
+        for (const auto& [key, value] : state.properties)
+        {
+            Append(out, (uint16_t) key.size());
+            out.append(key);
+            Append(out, (uint8_t) value.type);
+            switch (value.type)
+            {
+                case Plugin::NTYPE::STRING:
+                    Append(out, (uint32_t) value.sVal.size());
+                    out.append(value.sVal);
+                    break;
+                case Plugin::NTYPE::DOUBLE:
+                    Append(out, value.dVal);
+                    break;
+                case Plugin::NTYPE::INTEGER:
+                    Append(out, (int32_t) value.iVal);
+                    break;
+                default:
+                    Append(out, (uint8_t) value.bVal);
+                    break;
+            }
+        }
+    }
+
+    static bool Decode(EntityType type, const std::string& record, State& state)
+    {
+        Reader reader{ (const uint8_t*) record.data(), record.size() };
+        state.type = type;
+        bool ok = reader.Read(state.dimension) && reader.Read(state.model) && reader.Read(state.x) &&
+                reader.Read(state.y) && reader.Read(state.z) && reader.Read(state.rx) && reader.Read(state.ry) &&
+                reader.Read(state.rz);
+        if (ok && type == EntityType::Object)
+        {
+            ok = reader.Read(state.sx) && reader.Read(state.sy) && reader.Read(state.sz);
+        }
+        else if (ok && type == EntityType::Vehicle)
+        {
+            uint16_t length = 0;
+            ok = reader.Read(state.health) && reader.Read(state.color) && reader.Read(state.damage) &&
+                    reader.Read(length) && reader.ReadString(state.plate, length);
+        }
+        else if (ok && type == EntityType::NPC)
+        {
+            ok = reader.Read(state.health);
+        }
+
+        uint16_t count = 0;
+        if (!ok || !reader.Read(count))
+            return false;
+
+        for (uint16_t i = 0; i < count; i++)
+        {
+            uint16_t length = 0;
+            uint8_t kind = 0;
+            std::string key;
+            Plugin::NValue value;
+            if (!reader.Read(length) || !reader.ReadString(key, length) || !reader.Read(kind))
+                return false;
+
+            value.type = (Plugin::NTYPE) kind;
+            switch (value.type)
+            {
+                case Plugin::NTYPE::STRING:
+                {
+                    uint32_t size = 0;
+                    ok = reader.Read(size) && reader.ReadString(value.sVal, size);
+                    break;
+                }
+                case Plugin::NTYPE::DOUBLE:
+                    ok = reader.Read(value.dVal);
+                    break;
+                case Plugin::NTYPE::INTEGER:
+                {
+                    int32_t number = 0;
+                    ok = reader.Read(number);
+                    value.iVal = number;
+                    break;
+                }
+                case Plugin::NTYPE::BOOLEAN:
+                {
+                    uint8_t flag = 0;
+                    ok = reader.Read(flag);
+                    value.bVal = flag != 0;
+                    break;
+                }
+                default:
+                    ok = false;
+                    break;
+            }
+            if (!ok)
+                return false;
+            state.properties.emplace_back(std::move(key), std::move(value));
+        }
+        return true;
+    }
+
+    // calls the Lua helper with the ids and reads the numbers of its first and the strings of its second result
+    bool ReadValues(lua_State* L, const char* helper, const std::vector<int>& ids, int fields)
+    {
+        int top = lua_gettop(L);
+        int count = (int) ids.size();
+        this->values.assign((size_t) count * fields, 0);
+        this->strings.assign((size_t) count, std::string());
+        lua_getglobal(L, helper);
+        lua_createtable(L, count, 0);
+        for (int i = 0; i < count; i++)
+        {
+            lua_pushinteger(L, ids[i]);
+            lua_rawseti(L, -2, i + 1);
+        }
+
+        if (lua_pcall(L, 1, 2, 0) != LUA_OK)
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: %s failed: %s", helper, lua_tostring(L, -1));
+            lua_settop(L, top);
+            return false;
+        }
+
+        for (int i = 0; i < count * fields; i++)
+        {
+            lua_rawgeti(L, top + 1, i + 1);
+            this->values[i] = lua_tonumber(L, -1);
+            lua_pop(L, 1);
+        }
+        if (lua_istable(L, top + 2))
+        {
+            for (int i = 0; i < count; i++)
+            {
+                lua_rawgeti(L, top + 2, i + 1);
+                size_t length = 0;
+                const char* value = lua_tolstring(L, -1, &length);
+                if (value != nullptr)
+                    this->strings[i].assign(value, length);
+                lua_pop(L, 1);
+            }
+        }
+        lua_settop(L, top);
+        return true;
+    }
+
+    static void Fill(EntityType type, const double* v, State& state)
+    {
+        if (type == EntityType::NPC)
+        {
+            // the NPCs are read with the status helper: valid, x, y, z, heading, health
+            state.x = v[1];
+            state.y = v[2];
+            state.z = v[3];
+            state.ry = v[4];
+            state.health = v[5];
+            return;
+        }
+
+        state.model = (int32_t) v[1];
+        state.x = v[2];
+        state.y = v[3];
+        state.z = v[4];
+        state.rx = v[5];
+        state.ry = v[6];
+        state.rz = v[7];
+        if (type == EntityType::Object)
+        {
+            state.sx = v[8];
+            state.sy = v[9];
+            state.sz = v[10];
+            return;
+        }
+
+        state.health = v[8];
+        state.color = (uint32_t) v[9];
+        for (int i = 0; i < WORLD_SNAPSHOT_DAMAGES; i++)
+            state.damage[i] = (float) v[10 + i];
+    }
+
+    void CaptureType(lua_State* L, EntityType type, const char* helper, int fields, const std::vector<int>& ids,
+                     Frame_t& frame)
+    {
+        if (ids.empty() || !ReadValues(L, helper, ids, fields))
+            return;
+
+        for (size_t i = 0; i < ids.size(); i++)
+        {
+            const double* v = &this->values[i * fields];
+            if (v[0] == 0)
+                continue;
+
+            State state;
+            state.type = type;
+            Fill(type, v, state);
+            state.plate = std::move(this->strings[i]);
+            DimensionIndex::Get()->TryGet(type, ids[i], state.dimension);
+            const PropertyStore::Properties_t* properties = PropertyStore::Get()->FindAll(type, ids[i]);
+            if (properties != nullptr)
+            {
+                // tables are no plain values and stay out of the snapshot
+                for (const auto& [key, value] : *properties)
+                {
+                    if (value.type != Plugin::NTYPE::TABLE && value.type != Plugin::NTYPE::NONE)
+                        state.properties.emplace_back(key, value);
+                }
+            }
+
+            Encode(state, frame[MakeKey(type, ids[i])]);
+        }
+    }
+
+    static void AppendRecord(std::string& out, uint64_t key, const std::string* record)
+    {
+        RecordHeader header;
+        header.removed = record == nullptr ? 1 : 0;
+        header.type = (uint8_t) (key >> 32);
+        header.reserved = 0;
+        header.id = (int32_t) (uint32_t) key;
+        header.length = record == nullptr ? 0 : (uint32_t) record->size();
+        Append(out, header);
+        if (record != nullptr)
+            out.append(*record);
+    }
+
+    static void AppendFrame(std::string& out, uint32_t kind, uint32_t count, const std::string& records)
+    {
+        FrameHeader header;
+        header.size = (uint32_t) records.size();
+        header.kind = kind;
+        header.count = count;
+        header.crc = KvStore::Crc32(0, &header.size, sizeof(uint32_t) * 3);
+        header.crc = KvStore::Crc32(header.crc, records.data(), records.size());
+        Append(out, header);
+        out.append(records);
+    }
+
+    void CloseFile()
+    {
+        if (this->file != nullptr)
+            fclose(this->file);
+        this->file = nullptr;
+    }
+
+    void WriteFull(const Frame_t& frame)
+    {
+        CloseFile();
+        std::string records;
+        for (const auto& [key, record] : frame)
+            AppendRecord(records, key, &record);
+
+        std::string buffer(WORLD_SNAPSHOT_MAGIC, 4);
+        Append(buffer, (uint32_t) WORLD_SNAPSHOT_VERSION);
+        AppendFrame(buffer, WORLD_SNAPSHOT_FULL, (uint32_t) frame.size(), records);
+
+        std::string temp = this->path + ".tmp";
+        FILE* out = fopen(temp.c_str(), "wb");
+        bool ok = out != nullptr && fwrite(buffer.data(), 1, buffer.size(), out) == buffer.size() && KvStore::SyncFile(out);
+        if (out != nullptr)
+            fclose(out);
+
+        std::error_code error;
+        if (ok)
+            std::filesystem::rename(temp, this->path, error);
+        if (!ok || error)
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: could not write the world snapshot %s", this->path.c_str());
+            std::filesystem::remove(temp, error);
+            return;
+        }
+
+        this->file = fopen(this->path.c_str(), "ab");
+        this->baseBytes = buffer.size();
+        this->deltaBytes = 0;
+    }
+
+    void Write(std::unique_ptr<Frame_t> frame)
+    {
+        // once the deltas outgrow the base a restore would replay more than a fresh full frame costs to write
+        if (this->file == nullptr || this->deltaBytes > this->baseBytes)
+        {
+            WriteFull(*frame);
+            this->written = std::move(*frame);
+            return;
+        }
+
+        std::string records;
+        uint32_t count = 0;
+        for (const auto& [key, record] : *frame)
+        {
+            auto previous = this->written.find(key);
+            if (previous == this->written.end() || previous->second != record)
+            {
+                AppendRecord(records, key, &record);
+                count++;
+            }
+        }
+        for (const auto& entry : this->written)
+        {
+            if (frame->find(entry.first) == frame->end())
+            {
+                AppendRecord(records, entry.first, nullptr);
+                count++;
+            }
+        }
+
+        this->written = std::move(*frame);
+        if (count == 0)
+            return;
+
+        std::string buffer;
+        AppendFrame(buffer, WORLD_SNAPSHOT_DELTA, count, records);
+        if (fwrite(buffer.data(), 1, buffer.size(), this->file) != buffer.size() || !KvStore::SyncFile(this->file))
+        {
+            // a torn delta is cut off by the restore, the next snapshot starts over with a full frame
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: could not append to the world snapshot %s", this->path.c_str());
+            CloseFile();
+            return;
+        }
+        this->deltaBytes += buffer.size();
+    }
+
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        while (true)
+        {
+            this->wake.wait(lock, [this] { return !this->running || this->queued != nullptr; });
+            if (this->queued == nullptr)
+                break;
+
+            std::unique_ptr<Frame_t> frame = std::move(this->queued);
+            lock.unlock();
+            Write(std::move(frame));
+            lock.lock();
+        }
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->running = false;
+        }
+        this->wake.notify_one();
+        if (this->writer.joinable())
+            this->writer.join();
+        CloseFile();
+
+        if (this->owned)
+        {
+            std::error_code error;
+            std::filesystem::rename(this->path, (std::filesystem::path(this->path).parent_path() / "world.last.snap"), error);
+        }
+    }
+
+    // folds the valid frames of the snapshot file into the records, false if there is no snapshot
+    bool Read(Frame_t& records) const
+    {
+        MappedFile snapshot;
+        if (!snapshot.Open(this->path) || snapshot.GetSize() < WORLD_SNAPSHOT_HEADER)
+            return false;
+
+        const uint8_t* data = snapshot.GetData();
+        size_t size = snapshot.GetSize();
+        uint32_t version = 0;
+        memcpy(&version, data + 4, sizeof(version));
+        if (memcmp(data, WORLD_SNAPSHOT_MAGIC, 4) != 0 || version != WORLD_SNAPSHOT_VERSION)
+        {
+            LogRing::Get()->Writef(LogLevel::Error, "Onsharp: %s is no world snapshot of version %d", this->path.c_str(),
+                    WORLD_SNAPSHOT_VERSION);
+            return false;
+        }
+
+        size_t offset = WORLD_SNAPSHOT_HEADER;
+        int frames = 0;
+        while (size - offset >= sizeof(FrameHeader))
+        {
+            FrameHeader header;
+            memcpy(&header, data + offset, sizeof(header));
+            const uint8_t* body = data + offset + sizeof(FrameHeader);
+            if (header.size > size - offset - sizeof(FrameHeader))
+                break;
+
+            uint32_t crc = KvStore::Crc32(0, &header.size, sizeof(uint32_t) * 3);
+            if (KvStore::Crc32(crc, body, header.size) != header.crc)
+                break;
+
+            if (header.kind == WORLD_SNAPSHOT_FULL)
+                records.clear();
+
+            Reader reader{ body, header.size };
+            for (uint32_t i = 0; i < header.count; i++)
+            {
+                RecordHeader record;
+                std::string value;
+                if (!reader.Read(record) || !reader.ReadString(value, record.length))
+                    break;
+
+                uint64_t key = MakeKey((EntityType) record.type, record.id);
+                if (record.removed)
+                    records.erase(key);
+                else
+                    records[key] = std::move(value);
+            }
+
+            offset += sizeof(FrameHeader) + header.size;
+            frames++;
+        }
+
+        if (offset < size)
+        {
+            LogRing::Get()->Writef(LogLevel::Warning, "Onsharp: ignored the broken tail of the world snapshot after %d frames",
+                    frames);
+        }
+        return frames > 0;
+    }
+
+    // captures the next slice of the persistent entities, returns true once the whole snapshot is captured
+    bool CaptureSlice(lua_State* L)
+    {
+        static const char* const helpers[(int) EntityType::Count] = {
+                nullptr, "Onsharp_GetVehicleSnapshots", "Onsharp_GetNPCStatuses", "Onsharp_GetObjectSnapshots"
+        };
+        static const int fields[(int) EntityType::Count] = {
+                0, VEHICLE_SNAPSHOT_FIELDS, NPC_STATUS_FIELDS, OBJECT_SNAPSHOT_FIELDS
+        };
+
+        size_t budget = WORLD_SNAPSHOT_PER_TICK;
+        std::vector<int> slice;
+        for (int type = 0; type < (int) EntityType::Count && budget > 0; type++)
+        {
+            const std::vector<int>& ids = this->captureIds[type];
+            size_t& cursor = this->captureCursors[type];
+            if (cursor >= ids.size())
+                continue;
+
+            size_t count = std::min(budget, ids.size() - cursor);
+            slice.assign(ids.begin() + cursor, ids.begin() + cursor + count);
+            CaptureType(L, (EntityType) type, helpers[type], fields[type], slice, *this->capturing);
+            cursor += count;
+            budget -= count;
+        }
+        return budget > 0;
+    }
+
+    void BeginCapture()
+    {
+        this->capturing = std::make_unique<Frame_t>();
+        for (int type = 0; type < (int) EntityType::Count; type++)
+        {
+            this->captureIds[type].clear();
+            this->captureCursors[type] = 0;
+        }
+
+        for (uint64_t key : this->persistent)
+            this->captureIds[key >> 32].push_back((int) (uint32_t) key);
+    }
+
+    void QueueCapture()
+    {
+        this->owned = true;
+        {
+            // a frame the writer did not pick up yet is replaced, the deltas are built against the last written one
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->queued = std::move(this->capturing);
+        }
+        this->wake.notify_one();
+    }
+
+    static void Apply(State& state, int id)
+    {
+        static constexpr const char* dimensionSetters[(int) EntityType::Count] = ENTITY_NAME_TABLE(SetDimension);
+        static constexpr decltype(&EntityFunctions::SetPropertyValue<EntityType::Player>) propertySetters[] =
+                ENTITY_TYPE_TABLE(EntityFunctions::SetPropertyValue);
+
+        Plugin* plugin = Plugin::Get();
+        if (state.type == EntityType::Vehicle)
+        {
+            plugin->CallLuaDirect("SetVehicleRotation", 0, id, state.rx, state.ry, state.rz);
+            plugin->CallLuaDirect("SetVehicleHealth", 0, id, state.health);
+            plugin->CallLuaDirect("SetVehicleColor", 0, id, state.color);
+            plugin->CallLuaDirect("SetVehicleLicensePlate", 0, id,
+                    Plugin::LuaString{ state.plate.data(), (int) state.plate.size() });
+            for (int i = 0; i < WORLD_SNAPSHOT_DAMAGES; i++)
+                plugin->CallLuaDirect("SetVehicleDamage", 0, id, i + 1, (double) state.damage[i]);
+        }
+        else if (state.type == EntityType::NPC)
+        {
+            plugin->CallLuaDirect("SetNPCHealth", 0, id, state.health);
+        }
+
+        if (state.dimension != 0)
+        {
+            plugin->CallLuaDirect(dimensionSetters[(int) state.type], 0, id, state.dimension);
+            plugin->SetEntityDimension(state.type, id, state.dimension);
+        }
+
+        // whether a property was synced is not tracked, so the restored ones are synced to be safe
+        for (auto& [key, value] : state.properties)
+            propertySetters[(int) state.type](id, key.c_str(), &value, true);
+
+        WorldSnapshot::Get()->SetPersistent(state.type, id, true);
+    }
+
+public:
+    static bool IsSnapshotType(EntityType type)
+    {
+        return type == EntityType::Vehicle || type == EntityType::Object || type == EntityType::NPC;
+    }
+
+    // only persistent entities are written to the snapshots and restored after a crash
+    void SetPersistent(EntityType type, int id, bool persistent)
+    {
+        if (!persistent)
+            this->persistent.erase(MakeKey(type, id));
+        else if (IsSnapshotType(type))
+            this->persistent.insert(MakeKey(type, id));
+    }
+
+    // an interval of zero or less stops taking snapshots
+    void Configure(float interval)
+    {
+        this->interval = interval;
+        this->elapsed = 0;
+        if (interval <= 0 || this->running)
+            return;
+
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(this->path).parent_path(), error);
+        this->running = true;
+        this->writer = std::thread(&WorldSnapshot::Run, this);
+    }
+
+    // drops a capture in progress, the next snapshot starts a new one
+    void CancelCapture()
+    {
+        this->capturing.reset();
+        for (int type = 0; type < (int) EntityType::Count; type++)
+        {
+            this->captureIds[type].clear();
+            this->captureCursors[type] = 0;
+        }
+        this->restoreJob = 0;
+    }
+
+    void Tick(lua_State* L, float delta)
+    {
+        if (L == nullptr || this->interval <= 0)
+            return;
+
+        if (this->capturing != nullptr)
+        {
+            if (CaptureSlice(L))
+                QueueCapture();
+            return;
+        }
+
+        this->elapsed += delta;
+        if (this->elapsed < this->interval)
+            return;
+
+        // a snapshot of a half restored world would lose the rest of it on the next crash
+        this->elapsed = 0;
+        if (this->restoreJob != 0 && WorldLoader::Get()->IsPending(this->restoreJob))
+            return;
+
+        this->restoreJob = 0;
+        BeginCapture();
+        if (CaptureSlice(L))
+            QueueCapture();
+    }
+
+
+    // queues the entities of the snapshot left by a crash on the world loader, returns their count
+    int Restore(int perTick)
+    {
+        Frame_t records;
+        if (!Read(records))
+            return 0;
+
+        auto states = std::make_shared<std::vector<State>>();
+        std::vector<WorldLayoutEntry> entries;
+        states->reserve(records.size());
+        entries.reserve(records.size());
+        for (const auto& [key, record] : records)
+        {
+            State state;
+            auto type = (EntityType) (key >> 32);
+            if (!IsEntityType((int) type) || !Decode(type, record, state))
+                continue;
+
+            WorldLayoutEntry entry{};
+            entry.type = (uint8_t) type;
+            entry.model = state.model;
+            entry.x = (float) state.x;
+            entry.y = (float) state.y;
+            entry.z = (float) state.z;
+            entry.rx = (float) state.rx;
+            entry.ry = (float) state.ry;
+            entry.rz = (float) state.rz;
+            entry.sx = (float) state.sx;
+            entry.sy = (float) state.sy;
+            entry.sz = (float) state.sz;
+            entries.push_back(entry);
+            states->push_back(std::move(state));
+        }
+
+        int count = (int) entries.size();
+        this->owned = true;
+        if (count == 0)
+            return 0;
+
+        this->restoreJob = WorldLoader::Get()->Queue(std::move(entries), std::string(), perTick,
+                [states](uint32_t index, int id) { Apply((*states)[index], id); });
+        return count;
+    }
+};
+
+#endif